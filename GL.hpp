@@ -8,4 +8,8 @@
 #else
 #define GL_GLEXT_PROTOTYPES 1
 #include "glcorearb.h"
+//building with GL_TRACE counts and times every GL call (see gl_trace.hpp):
+#ifdef GL_TRACE
+#include "gl_trace.hpp"
+#endif
 #endif
@@ -0,0 +1,94 @@
+#include "asset_pack.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#define LOG_ERROR( X ) std::cerr << X << std::endl
+
+bool save_asset_pack(std::string const &filename, std::vector< AssetPackImage > const &images) {
+	AssetPackHeader header;
+	header.magic = AssetPackMagic;
+	header.version = AssetPackVersion;
+	header.count = images.size();
+
+	std::vector< AssetPackEntry > entries(images.size());
+	uint64_t offset = sizeof(AssetPackHeader) + entries.size() * sizeof(AssetPackEntry);
+	for (size_t i = 0; i < images.size(); ++i) {
+		AssetPackImage const &image = images[i];
+		AssetPackEntry &entry = entries[i];
+		if (image.name.size() >= sizeof(entry.name)) {
+			LOG_ERROR("  name '" << image.name << "' is too long for an asset pack.");
+			return false;
+		}
+		if (image.data.size() != size_t(image.width) * image.height) {
+			LOG_ERROR("  image '" << image.name << "' has the wrong amount of data.");
+			return false;
+		}
+		std::memset(entry.name, 0, sizeof(entry.name));
+		std::memcpy(entry.name, image.name.c_str(), image.name.size());
+		entry.width = image.width;
+		entry.height = image.height;
+		offset = (offset + AssetPackAlignment - 1) / AssetPackAlignment * AssetPackAlignment;
+		entry.offset = offset;
+		offset += image.data.size() * sizeof(uint32_t);
+	}
+
+	std::ofstream file(filename.c_str(), std::ios::binary);
+	file.write(reinterpret_cast< char const * >(&header), sizeof(header));
+	file.write(reinterpret_cast< char const * >(entries.data()), entries.size() * sizeof(AssetPackEntry));
+	uint64_t at = sizeof(AssetPackHeader) + entries.size() * sizeof(AssetPackEntry);
+	static const char zeros[AssetPackAlignment] = { 0 };
+	for (size_t i = 0; i < images.size(); ++i) {
+		file.write(zeros, entries[i].offset - at);
+		file.write(reinterpret_cast< char const * >(images[i].data.data()), images[i].data.size() * sizeof(uint32_t));
+		at = entries[i].offset + images[i].data.size() * sizeof(uint32_t);
+	}
+	if (!file) {
+		LOG_ERROR("  failed to write '" << filename << "'.");
+		return false;
+	}
+	return true;
+}
+
+bool AssetPack::open(std::string const &filename) {
+	images.clear();
+	if (!file.open(filename)) return false;
+
+	auto fail = [this, &filename](char const *why) {
+		LOG_ERROR("  asset pack '" << filename << "' " << why << ".");
+		images.clear();
+		file.close();
+		return false;
+	};
+
+	AssetPackHeader header;
+	if (file.size < sizeof(header)) return fail("is truncated");
+	std::memcpy(&header, file.data, sizeof(header));
+	if (header.magic != AssetPackMagic) return fail("has the wrong magic number");
+	if (header.version != AssetPackVersion) return fail("has the wrong version");
+	if ((file.size - sizeof(header)) / sizeof(AssetPackEntry) < header.count) return fail("has a truncated index");
+
+	for (uint32_t i = 0; i < header.count; ++i) {
+		AssetPackEntry entry;
+		std::memcpy(&entry, file.data + sizeof(header) + i * sizeof(AssetPackEntry), sizeof(entry));
+		uint64_t bytes = uint64_t(entry.width) * entry.height * sizeof(uint32_t);
+		if (entry.offset % sizeof(uint32_t) != 0 || entry.offset > file.size || bytes > file.size - entry.offset) {
+			return fail("has an image past the end of the file");
+		}
+		entry.name[sizeof(entry.name)-1] = '\0';
+		Image image;
+		image.width = entry.width;
+		image.height = entry.height;
+		image.pixels = reinterpret_cast< uint32_t const * >(file.data + entry.offset);
+		images.insert(std::make_pair(std::string(entry.name), image));
+	}
+
+	return true;
+}
+
+AssetPack::Image const *AssetPack::find(std::string const &name) const {
+	auto f = images.find(name);
+	if (f == images.end()) return nullptr;
+	return &f->second;
+}
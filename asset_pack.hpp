@@ -0,0 +1,62 @@
+#pragma once
+
+#include "mapped_file.hpp"
+
+#include <map>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+/*
+ * Baked asset pack: images stored as raw RGBA pixels (LowerLeftOrigin), so
+ * loading is just mapping the file -- no decompression at startup.
+ *
+ * Built from PNGs by the 'bake' tool (see bake.cpp).
+ */
+
+//On-disk layout (host byte order; the magic doubles as an endianness check):
+//  AssetPackHeader, then 'count' AssetPackEntry records, then pixel data.
+//  Each image's pixels start at a multiple of AssetPackAlignment, rows tightly packed.
+struct AssetPackHeader {
+	uint32_t magic = 0;
+	uint32_t version = 0;
+	uint32_t count = 0;
+	uint32_t reserved = 0;
+};
+
+struct AssetPackEntry {
+	char name[48]; //null-terminated
+	uint32_t width = 0;
+	uint32_t height = 0;
+	uint64_t offset = 0; //of pixel data from start of file
+};
+static_assert(sizeof(AssetPackEntry) == 64, "AssetPackEntry is nicely packed.");
+
+static const uint32_t AssetPackMagic = 0x6b617061; //'apak' when read little-endian
+static const uint32_t AssetPackVersion = 1;
+static const uint32_t AssetPackAlignment = 4096; //page-aligned, so each image can be read (or mapped) independently
+
+struct AssetPackImage {
+	std::string name;
+	uint32_t width = 0;
+	uint32_t height = 0;
+	std::vector< uint32_t > data; //width * height, LowerLeftOrigin
+};
+//Write 'images' to a pack; returns false on failure:
+bool save_asset_pack(std::string const &filename, std::vector< AssetPackImage > const &images);
+
+struct AssetPack {
+	//map 'filename' and read its index; returns false (leaving the pack empty) if missing or malformed:
+	bool open(std::string const &filename);
+
+	struct Image {
+		uint32_t width = 0;
+		uint32_t height = 0;
+		uint32_t const *pixels = nullptr; //width * height, LowerLeftOrigin; points into the mapping
+	};
+	//returns nullptr if 'name' isn't in the pack:
+	Image const *find(std::string const &name) const;
+
+	MappedFile file;
+	std::map< std::string, Image > images;
+};
@@ -0,0 +1,215 @@
+#include "atlas.hpp"
+#include "asset_pack.hpp"
+#include "load_save_png.hpp"
+#include "mapped_file.hpp"
+#include "pixel_ops.hpp"
+#include "png_cache.hpp"
+#include "thread_pool.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <iostream>
+
+#define LOG_ERROR( X ) std::cerr << X << std::endl
+
+//atlas rows are at least this wide; wider images get a row to themselves:
+static const unsigned int AtlasMinWidth = 2048;
+
+//each image is surrounded by a one-pixel border copied from its edge,
+// so that nearest/linear sampling at the image edge never picks up a neighbor:
+static const unsigned int AtlasPadding = 1;
+
+struct AtlasLoader::Image {
+	std::string name;
+	MappedFile file;
+	glm::uvec2 size = glm::uvec2(0);
+	glm::uvec2 at = glm::uvec2(0);
+	unsigned int shelf = 0;
+	uint32_t const *baked = nullptr; //pixels from an asset pack (LowerLeftOrigin), if not decoding 'file'
+};
+
+AtlasLoader::AtlasLoader() {
+}
+
+AtlasLoader::~AtlasLoader() {
+}
+
+bool load_atlas(std::vector< std::string > const &filenames, Atlas *atlas, ThreadPool *pool) {
+	assert(atlas);
+	AtlasLoader loader;
+	if (!loader.open(filenames, atlas)) return false;
+	atlas->data.resize(atlas->size.x * atlas->size.y);
+	if (!loader.decode(&atlas->data[0], pool)) {
+		atlas->size = glm::uvec2(0);
+		atlas->data.clear();
+		atlas->entries.clear();
+		return false;
+	}
+	return true;
+}
+
+bool AtlasLoader::open(std::vector< std::string > const &filenames, Atlas *atlas, AssetPack const *pack, PngCache const *cache_) {
+	assert(atlas);
+	atlas->size = glm::uvec2(0);
+	atlas->data.clear();
+	atlas->entries.clear();
+	size = glm::uvec2(0);
+	images.clear();
+	shelves.clear();
+	cache = (cache_ && cache_->enabled() ? cache_ : nullptr);
+
+	//map every file and read just its header, so the atlas can be laid out before any pixels are decoded:
+	for (auto const &filename : filenames) {
+		images.emplace_back(new Image);
+		Image &image = *images.back();
+		image.name = filename;
+		AssetPack::Image const *baked = (pack ? pack->find(filename) : nullptr);
+		if (baked) {
+			image.size = glm::uvec2(baked->width, baked->height);
+			image.baked = baked->pixels;
+			continue;
+		}
+		if (!image.file.open(image.name)
+		 || !load_png_size(image.file.data, image.file.size, &image.size.x, &image.size.y)) {
+			LOG_ERROR("  failed to load '" << image.name << "' for atlas.");
+			images.clear();
+			return false;
+		}
+	}
+
+	//shelf packing: place tallest images first, left-to-right, starting a new shelf when a row fills:
+	std::vector< Image * > order;
+	unsigned int width = AtlasMinWidth;
+	for (auto &image : images) {
+		order.emplace_back(image.get());
+		width = std::max(width, image->size.x + 2 * AtlasPadding);
+	}
+	std::stable_sort(order.begin(), order.end(), [](Image const *a, Image const *b){
+		return a->size.y > b->size.y;
+	});
+
+	Shelf shelf;
+	for (auto image : order) {
+		glm::uvec2 padded = image->size + glm::uvec2(2 * AtlasPadding);
+		if (shelf.used + padded.x > width) {
+			shelves.emplace_back(shelf);
+			shelf.bottom += shelf.height;
+			shelf.height = 0;
+			shelf.used = 0;
+		}
+		image->at = glm::uvec2(shelf.used, shelf.bottom) + glm::uvec2(AtlasPadding);
+		image->shelf = shelves.size();
+		shelf.used += padded.x;
+		shelf.height = std::max(shelf.height, padded.y);
+	}
+	shelves.emplace_back(shelf);
+
+	size = glm::uvec2(width, shelf.bottom + shelf.height);
+	atlas->size = size;
+
+	for (auto const &image : images) {
+		Atlas::Entry entry;
+		entry.at = image->at;
+		entry.size = image->size;
+		entry.min_uv = glm::vec2(entry.at) / glm::vec2(size);
+		entry.max_uv = glm::vec2(entry.at + entry.size) / glm::vec2(size);
+		atlas->entries.insert(std::make_pair(image->name, entry));
+	}
+
+	return true;
+}
+
+bool AtlasLoader::decode(uint32_t *pixels, ThreadPool *pool, uint32_t ops) const {
+	assert(pixels);
+	unsigned int stride = size.x;
+
+	//decode (or copy) each image straight into its spot in the atlas, then extrude its edges into the padding
+	// and clear the rest of its column of the shelf (padded rectangles don't overlap, so images can
+	// be decoded in parallel):
+	std::vector< char > loaded(images.size(), 0);
+	auto decode_image = [this, pixels, stride, ops, &loaded](unsigned int i) {
+		Image const &image = *images[i];
+		glm::uvec2 const &at = image.at;
+		glm::uvec2 const &size = image.size;
+		uint32_t *base = pixels + at.y * stride + at.x;
+		//copy a size.x * size.y image into place, applying 'ops' to each row on the way
+		// (in a small cached buffer, so that 'pixels' is only ever written):
+		std::vector< uint32_t > row;
+		auto copy_from = [base, stride, &size, ops, &row](uint32_t const *src) {
+			for (unsigned int y = 0; y < size.y; ++y) {
+				uint32_t const *from = src + y * size.x;
+				if (ops != PixelOpsNone) {
+					row.assign(from, from + size.x);
+					process_pixels(&row[0], size.x, 1, size.x, ops);
+					from = &row[0];
+				}
+				std::memcpy(base + y * stride, from, size.x * sizeof(uint32_t));
+			}
+		};
+		MappedFile blob;
+		std::string key;
+		uint32_t const *cached = nullptr;
+		if (!image.baked && cache) {
+			key = cache->key(image.file.data, image.file.size, LowerLeftOrigin);
+			cached = cache->find(key, size.x, size.y, &blob);
+		}
+		if (image.baked) {
+			copy_from(image.baked);
+		} else if (cached) {
+			copy_from(cached);
+		} else if (cache || ops != PixelOpsNone) {
+			//decode to a temporary, since reading all of 'pixels' back (to store or process it) may be slow (e.g., a mapped unpack buffer):
+			std::vector< uint32_t > decoded(size.x * size.y);
+			if (!load_png(image.file.data, image.file.size, size.x, size.y, &decoded[0], size.x, LowerLeftOrigin)) {
+				LOG_ERROR("  failed to load '" << image.name << "' for atlas.");
+				return;
+			}
+			//(the cache holds images as decoded, since 'ops' may differ between runs)
+			if (cache) cache->store(key, size.x, size.y, &decoded[0], size.x);
+			copy_from(&decoded[0]);
+		} else if (!load_png(image.file.data, image.file.size, size.x, size.y, base, stride, LowerLeftOrigin)) {
+			LOG_ERROR("  failed to load '" << image.name << "' for atlas.");
+			return;
+		}
+		for (unsigned int y = 0; y < size.y; ++y) {
+			uint32_t *row = base + y * stride;
+			for (unsigned int p = 1; p <= AtlasPadding; ++p) {
+				*(row - p) = row[0];
+				*(row + size.x - 1 + p) = row[size.x - 1];
+			}
+		}
+		uint32_t *top = base + (size.y - 1) * stride;
+		for (unsigned int p = 1; p <= AtlasPadding; ++p) {
+			std::copy(base - AtlasPadding, base + size.x + AtlasPadding, base - p * stride - AtlasPadding);
+			std::copy(top - AtlasPadding, top + size.x + AtlasPadding, top + p * stride - AtlasPadding);
+		}
+		Shelf const &shelf = shelves[image.shelf];
+		for (unsigned int y = at.y + size.y + AtlasPadding; y < shelf.bottom + shelf.height; ++y) {
+			std::memset(pixels + y * stride + at.x - AtlasPadding, 0, (size.x + 2 * AtlasPadding) * sizeof(uint32_t));
+		}
+		loaded[i] = 1;
+	};
+	for (unsigned int i = 0; i < images.size(); ++i) {
+		if (pool) {
+			pool->run([&decode_image, i](){ decode_image(i); });
+		} else {
+			decode_image(i);
+		}
+	}
+
+	//clear the unused ends of shelves (meanwhile):
+	for (auto const &shelf : shelves) {
+		if (shelf.used == stride) continue;
+		for (unsigned int y = shelf.bottom; y < shelf.bottom + shelf.height; ++y) {
+			std::memset(pixels + y * stride + shelf.used, 0, (stride - shelf.used) * sizeof(uint32_t));
+		}
+	}
+
+	if (pool) pool->wait();
+
+	for (auto l : loaded) {
+		if (!l) return false;
+	}
+	return true;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+/*
+ * Pack several PNG images into one texture atlas, so that every sprite
+ * can be drawn from a single texture (and, therefore, a single draw call).
+ */
+
+struct Atlas {
+	struct Entry {
+		glm::uvec2 at = glm::uvec2(0); //lower-left corner of image in atlas (pixels)
+		glm::uvec2 size = glm::uvec2(0); //size of image (pixels)
+		glm::vec2 min_uv = glm::vec2(0.0f);
+		glm::vec2 max_uv = glm::vec2(0.0f);
+	};
+	glm::uvec2 size = glm::uvec2(0);
+	std::vector< uint32_t > data; //size.x * size.y pixels, LowerLeftOrigin
+	std::map< std::string, Entry > entries; //indexed by filename
+};
+
+struct ThreadPool;
+struct AssetPack;
+struct PngCache;
+
+//Load each of 'filenames' and pack them into 'atlas'; returns false if any image fails to load.
+//If 'pool' is given, images are decoded in parallel on it (so do not call from one of its jobs):
+bool load_atlas(std::vector< std::string > const &filenames, Atlas *atlas, ThreadPool *pool = nullptr);
+
+//Two-phase loading, for decoding straight into memory the caller provides (e.g., a mapped pixel-unpack buffer):
+struct AtlasLoader {
+	AtlasLoader();
+	~AtlasLoader();
+	AtlasLoader(AtlasLoader const &) = delete;
+	AtlasLoader &operator=(AtlasLoader const &) = delete;
+
+	//map each of 'filenames' and read only their headers to lay out 'atlas' (sets size and entries; data is left empty).
+	//Images found in 'pack' are copied from it instead of being decoded; other images are looked up in
+	// (and, once decoded, stored to) 'cache'. Both must outlive the loader:
+	bool open(std::vector< std::string > const &filenames, Atlas *atlas, AssetPack const *pack = nullptr, PngCache const *cache = nullptr);
+	//decode every image, with padding, into 'pixels' (size.x * size.y, LowerLeftOrigin); unused space is zeroed.
+	//('pixels' must be readable, but only image edges are read back)
+	//'ops' (see pixel_ops.hpp) are applied to each image before its edges are extruded.
+	//If 'pool' is given, images are decoded in parallel on it (so do not call from one of its jobs):
+	bool decode(uint32_t *pixels, ThreadPool *pool = nullptr, uint32_t ops = 0) const;
+
+	glm::uvec2 size = glm::uvec2(0);
+
+private:
+	struct Image;
+	std::vector< std::unique_ptr< Image > > images;
+	struct Shelf {
+		unsigned int bottom = 0; //first row
+		unsigned int height = 0;
+		unsigned int used = 0; //next free column
+	};
+	std::vector< Shelf > shelves;
+	PngCache const *cache = nullptr;
+};
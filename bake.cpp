@@ -0,0 +1,38 @@
+#include "asset_pack.hpp"
+#include "load_save_png.hpp"
+
+#include <iostream>
+
+/*
+ * Offline asset baking: convert PNGs to a raw asset pack so the game
+ * doesn't have to decompress them at startup.
+ *
+ * Usage: bake OUT.pack IN.png [IN.png ...]
+ * Images are stored under their file name, without directory.
+ */
+
+int main(int argc, char **argv) {
+	if (argc < 3) {
+		std::cerr << "Usage:\n\t" << argv[0] << " OUT.pack IN.png [IN.png ...]" << std::endl;
+		return 1;
+	}
+
+	std::vector< AssetPackImage > images;
+	for (int i = 2; i < argc; ++i) {
+		std::string path = argv[i];
+		images.emplace_back();
+		AssetPackImage &image = images.back();
+		image.name = path.substr(path.find_last_of("/\\") + 1);
+		if (!load_png(path, &image.width, &image.height, &image.data, LowerLeftOrigin)) {
+			std::cerr << "Failed to load '" << path << "'." << std::endl;
+			return 1;
+		}
+	}
+
+	if (!save_asset_pack(argv[1], images)) {
+		std::cerr << "Failed to save '" << argv[1] << "'." << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
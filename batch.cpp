@@ -0,0 +1,164 @@
+#include "batch.hpp"
+#include "maze.hpp"
+#include "thread_pool.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+//agents are simulated in chunks of this many; a multiple of 16 so that each
+// chunk's slice of every (cache-line-aligned) array starts on its own cache line:
+static const uint32_t ChunkAgents = 64;
+static const uintptr_t CacheLine = 64;
+
+//fixed-size array aligned to a cache line (std::vector only guarantees alignof(T)):
+template< typename T >
+struct AlignedArray {
+	explicit AlignedArray(size_t count) : size(count) {
+		storage = std::malloc(sizeof(T) * count + CacheLine);
+		if (!storage) throw std::bad_alloc();
+		data = reinterpret_cast< T * >((reinterpret_cast< uintptr_t >(storage) + CacheLine - 1) & ~(CacheLine - 1));
+		std::fill(data, data + count, T(0));
+	}
+	~AlignedArray() { std::free(storage); }
+	AlignedArray(AlignedArray const &) = delete;
+	AlignedArray &operator=(AlignedArray const &) = delete;
+	T &operator[](size_t i) { return data[i]; }
+	T const &operator[](size_t i) const { return data[i]; }
+	size_t size = 0;
+	T *data = nullptr;
+	void *storage = nullptr;
+};
+
+//xorshift64*: small, fast per-agent random state:
+static inline uint64_t next_random(uint64_t *state) {
+	uint64_t x = *state;
+	x ^= x >> 12;
+	x ^= x << 25;
+	x ^= x >> 27;
+	*state = x;
+	return x * 0x2545F4914F6CDD1DULL;
+}
+
+int run_batch(HeadlessConfig const &config) {
+	Maze const maze = (config.width && config.height ? Maze::generate(config.width, config.height, config.seed) : Maze::cave());
+	uint32_t const tiles = maze.width * maze.height;
+	uint32_t const agents = config.agents;
+
+	//what an agent could possibly achieve (random mazes are perfect, but the cave may have unreachable corners):
+	uint32_t shortest = -1U; //fewest moves to the treasure
+	uint32_t const reachable = maze.reachable(maze.start, &shortest).count();
+	//how exposed the maze is: tiles with a passage to a mine (word-wide, for every mine at once):
+	uint32_t const near_mines = maze.expand(maze.mines).count();
+
+	//agent state, structure-of-arrays:
+	AlignedArray< uint64_t > rng(agents);
+	AlignedArray< uint64_t > moves(agents); //moves taken (until treasure, or the move limit)
+	AlignedArray< uint64_t > treasure_move(agents); //moves taken when treasure was reached (0 = never)
+	AlignedArray< uint32_t > mines_hit(agents);
+	AlignedArray< uint32_t > visited_count(agents);
+
+	for (uint32_t a = 0; a < agents; ++a) {
+		//splitmix64 of (seed, agent) so that every agent gets a distinct, nonzero stream:
+		uint64_t z = config.seed + 0x9E3779B97F4A7C15ULL * (a + 1);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+		z ^= z >> 31;
+		rng[a] = (z ? z : 1);
+	}
+
+	//simulate agents [begin, end):
+	auto simulate = [&](uint32_t begin, uint32_t end) {
+		//tiles seen by the current agent (one bitset per chunk, reused for each of its agents; only the count is kept):
+		std::vector< uint64_t > seen((tiles + 63) / 64);
+		for (uint32_t a = begin; a < end; ++a) {
+			std::fill(seen.begin(), seen.end(), 0);
+			uint64_t state = rng[a];
+			uint32_t at = maze.start;
+			uint32_t seen_count = 1;
+			seen[at >> 6] |= uint64_t(1) << (at & 63);
+			uint64_t taken = 0;
+			uint64_t found = 0;
+			uint32_t mines = 0;
+			uint64_t bits = 0;
+			uint32_t bits_left = 0;
+			for (uint64_t m = 0; m < config.moves; ++m) {
+				if (bits_left == 0) {
+					bits = next_random(&state);
+					bits_left = 32;
+				}
+				Direction dir = Direction(bits & 3);
+				bits >>= 2;
+				--bits_left;
+				if (!maze.can_move(at, dir)) continue;
+				at = maze.step(at, dir);
+				++taken;
+				uint64_t bit = uint64_t(1) << (at & 63);
+				if (!(seen[at >> 6] & bit)) {
+					seen[at >> 6] |= bit;
+					++seen_count;
+				}
+				if (maze.mines.get(at)) ++mines;
+				if (maze.treasure.get(at)) {
+					found = taken;
+					break;
+				}
+			}
+			rng[a] = state;
+			moves[a] = taken;
+			treasure_move[a] = found;
+			mines_hit[a] = mines;
+			visited_count[a] = seen_count;
+		}
+	};
+
+	auto before = std::chrono::high_resolution_clock::now();
+	uint32_t threads = 0;
+	{
+		ThreadPool pool(config.threads);
+		threads = pool.size();
+		for (uint32_t begin = 0; begin < agents; begin += ChunkAgents) {
+			uint32_t end = std::min(agents, begin + ChunkAgents);
+			pool.run([&simulate, begin, end](){ simulate(begin, end); });
+		}
+		pool.wait();
+	}
+	auto after = std::chrono::high_resolution_clock::now();
+	double seconds = std::chrono::duration< double >(after - before).count();
+
+	//aggregate:
+	uint64_t total_moves = 0;
+	uint64_t total_mines = 0;
+	double total_coverage = 0.0;
+	std::vector< uint64_t > to_treasure;
+	for (uint32_t a = 0; a < agents; ++a) {
+		total_moves += moves[a];
+		total_mines += mines_hit[a];
+		total_coverage += double(visited_count[a]) / reachable;
+		if (treasure_move[a]) to_treasure.emplace_back(treasure_move[a]);
+	}
+	std::sort(to_treasure.begin(), to_treasure.end());
+
+	std::cout << "Maze: " << maze.width << "x" << maze.height << " (" << (config.width && config.height ? "random" : "cave") << ")\n";
+	std::cout << "Agents: " << agents << " on " << threads << " threads, at most " << config.moves << " moves each\n";
+	std::cout << "Reachable tiles: " << reachable << " / " << tiles;
+	if (shortest != -1U) std::cout << ", treasure " << shortest << " moves from the start";
+	std::cout << "\n";
+	std::cout << "Found treasure: " << to_treasure.size() << " (" << (100.0 * to_treasure.size() / agents) << "%)\n";
+	if (!to_treasure.empty()) {
+		uint64_t sum = 0;
+		for (auto m : to_treasure) sum += m;
+		std::cout << "Moves to treasure: mean " << double(sum) / to_treasure.size()
+			<< ", median " << to_treasure[to_treasure.size() / 2]
+			<< ", min " << to_treasure.front()
+			<< ", max " << to_treasure.back() << "\n";
+	}
+	std::cout << "Mines: " << maze.mines.count() << ", next to " << near_mines << " tiles (" << (100.0 * near_mines / tiles) << "%)\n";
+	std::cout << "Mines hit per agent: " << double(total_mines) / agents << "\n";
+	std::cout << "Coverage per agent: " << (100.0 * total_coverage / agents) << "% of reachable tiles\n";
+	std::cout << "Moves taken: " << total_moves << "\n";
+	std::cout << "Time: " << seconds << "s (" << (seconds > 0.0 ? total_moves / seconds : 0.0) << " moves/s)" << std::endl;
+	return 0;
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "headless.hpp"
+
+/*
+ * Batch simulation: runs many independent explorer agents over one maze on
+ * a work-stealing thread pool and reports aggregate statistics (moves to
+ * treasure, mines hit, coverage) next to what a perfect explorer would do
+ * (shortest path to the treasure, tiles reachable at all) and how many
+ * tiles border a mine.
+ *
+ * Agent state is stored structure-of-arrays and handed to threads in
+ * cache-line-aligned chunks, so no two threads write the same cache line.
+ */
+
+//run config.agents agents (each for at most config.moves moves, stopping at the treasure) on config.threads threads:
+int run_batch(HeadlessConfig const &config);
@@ -0,0 +1,96 @@
+#include "maze.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+/*
+ * Benchmark (and cross-check) the word-wide maze query expand() against the
+ * same query done a tile at a time with can_move() and step().
+ *
+ * Usage: bench_maze [WIDTH HEIGHT]   (default 1024 1024)
+ */
+
+//expand(), a tile at a time:
+static Bitset expand_per_tile(Maze const &maze, Bitset const &from) {
+	Bitset out(from.size);
+	for (uint32_t t = 0; t < from.size; ++t) {
+		if (!from.get(t)) continue;
+		for (uint32_t d = 0; d < 4; ++d) {
+			if (maze.can_move(t, Direction(d))) out.set(maze.step(t, Direction(d)));
+		}
+	}
+	return out;
+}
+
+//random bitset with about one bit in eight set:
+static Bitset random_tiles(uint32_t size, uint64_t *state) {
+	Bitset out(size);
+	for (uint32_t t = 0; t < size; ++t) {
+		*state ^= *state << 13;
+		*state ^= *state >> 7;
+		*state ^= *state << 17;
+		if ((*state & 7) == 0) out.set(t);
+	}
+	return out;
+}
+
+int main(int argc, char **argv) {
+	uint32_t width = 1024;
+	uint32_t height = 1024;
+	if (argc == 3) {
+		width = std::strtoul(argv[1], nullptr, 10);
+		height = std::strtoul(argv[2], nullptr, 10);
+	} else if (argc != 1) {
+		std::cerr << "Usage:\n\t" << argv[0] << " [WIDTH HEIGHT]" << std::endl;
+		return 1;
+	}
+
+	//cross-check on the cave and on mazes whose rows don't line up with words (or are a single tile wide):
+	bool ok = true;
+	uint64_t state = 0x9E3779B97F4A7C15ULL;
+	std::vector< Maze > mazes{ Maze::cave(), Maze::generate(37, 23, 1), Maze::generate(1, 100, 2), Maze::generate(100, 1, 3), Maze::generate(64, 64, 4) };
+	for (auto const &maze : mazes) {
+		uint32_t tiles = maze.width * maze.height;
+		for (uint32_t i = 0; i < 8; ++i) {
+			Bitset from = random_tiles(tiles, &state);
+			if (maze.expand(from).words != expand_per_tile(maze, from).words) {
+				std::cout << "  expand: MISMATCH vs per-tile on " << maze.width << "x" << maze.height << std::endl;
+				ok = false;
+				break;
+			}
+		}
+	}
+
+	Maze maze = Maze::generate(width, height, 5);
+	uint32_t tiles = width * height;
+	Bitset from = random_tiles(tiles, &state);
+
+	struct Query {
+		char const *name;
+		std::function< Bitset() > run;
+	};
+	std::vector< Query > queries{
+		{ "expand [words]", [&](){ return maze.expand(from); } },
+		{ "expand [tiles]", [&](){ return expand_per_tile(maze, from); } },
+	};
+
+	static const unsigned int Iterations = 5;
+	std::cout << width << "x" << height << " maze, best of " << Iterations << " runs:" << std::endl;
+	for (auto const &query : queries) {
+		double best = 1e30;
+		for (unsigned int i = 0; i < Iterations; ++i) {
+			auto before = std::chrono::high_resolution_clock::now();
+			Bitset result = query.run();
+			auto after = std::chrono::high_resolution_clock::now();
+			best = std::min(best, std::chrono::duration< double >(after - before).count());
+		}
+		std::cout << "  " << query.name << ": " << best * 1000.0 << "ms (" << tiles / best / 1e6 << " Mtiles/s)" << std::endl;
+	}
+
+	std::cout << (ok ? "Word-wide expand matches per-tile one." : "MISMATCH between word-wide and per-tile expand.") << std::endl;
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,82 @@
+#include "pixel_ops.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+/*
+ * Benchmark (and cross-check) the pixel_ops kernels at every SIMD level
+ * this CPU supports (and that the kernel has a version for).
+ *
+ * Usage: bench_pixels [WIDTH HEIGHT]   (default 2048 2048)
+ */
+
+int main(int argc, char **argv) {
+	unsigned int width = 2048;
+	unsigned int height = 2048;
+	if (argc == 3) {
+		width = std::strtoul(argv[1], nullptr, 10);
+		height = std::strtoul(argv[2], nullptr, 10);
+	} else if (argc != 1) {
+		std::cerr << "Usage:\n\t" << argv[0] << " [WIDTH HEIGHT]" << std::endl;
+		return 1;
+	}
+	//(an odd width exercises the scalar tails of the vector loops)
+	size_t count = size_t(width) * height;
+
+	std::vector< uint32_t > source(count);
+	uint32_t state = 0x12345678;
+	for (auto &p : source) {
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		p = state;
+	}
+
+	struct Kernel {
+		char const *name;
+		SimdLevel max_level; //highest level with its own version
+		std::function< void(uint32_t *) > run;
+	};
+	std::vector< Kernel > kernels{
+		{ "premultiply_alpha", SimdAVX2, [&](uint32_t *px){ premultiply_alpha(px, count); } },
+		{ "swap_red_blue", SimdAVX2, [&](uint32_t *px){ swap_red_blue(px, count); } },
+		{ "flip_rows", SimdAVX2, [&](uint32_t *px){ flip_rows(px, width, height, width); } },
+		{ "srgb_to_linear", SimdScalar, [&](uint32_t *px){ srgb_to_linear(px, count); } },
+	};
+
+	static const unsigned int Iterations = 20;
+	std::cout << width << "x" << height << " pixels, best of " << Iterations << " runs:" << std::endl;
+
+	bool ok = true;
+	for (auto const &kernel : kernels) {
+		//reference result from the scalar kernel:
+		set_simd_level(SimdScalar);
+		std::vector< uint32_t > expected = source;
+		kernel.run(&expected[0]);
+
+		for (int l = SimdScalar; l <= kernel.max_level; ++l) {
+			if (set_simd_level(SimdLevel(l)) != SimdLevel(l)) continue;
+
+			std::vector< uint32_t > pixels = source;
+			kernel.run(&pixels[0]);
+			bool match = (pixels == expected);
+			ok = ok && match;
+
+			double best = 1e30;
+			for (unsigned int i = 0; i < Iterations; ++i) {
+				auto before = std::chrono::high_resolution_clock::now();
+				kernel.run(&pixels[0]);
+				auto after = std::chrono::high_resolution_clock::now();
+				best = std::min(best, std::chrono::duration< double >(after - before).count());
+			}
+			std::cout << "  " << kernel.name << " [" << simd_level_name(SimdLevel(l)) << "]: "
+				<< best * 1000.0 << "ms (" << count / best / 1e6 << " Mpix/s)"
+				<< (match ? "" : "  MISMATCH vs scalar") << std::endl;
+		}
+	}
+
+	return ok ? 0 : 1;
+}
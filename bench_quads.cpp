@@ -0,0 +1,336 @@
+#include "GL.hpp"
+#include "gl_state.hpp"
+#include "gpu_timer.hpp"
+#include "quad_indices.hpp"
+#include "shader.hpp"
+#include "static_mesh.hpp"
+#include "vertex_ring.hpp"
+
+#include <SDL.h>
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+/*
+ * Benchmark ways of submitting many small textured quads, streamed through a
+ * VertexRing every frame as the game does:
+ *   strip     - one triangle strip, six vertices per quad (with the degenerate joins)
+ *   indexed   - four vertices per quad, triangles from the shared QuadIndices buffer
+ *   instanced - one instance per quad (laid out like the game's Sprite), expanded from a static unit quad
+ * at 1k, 10k, and 100k quads, into an offscreen framebuffer.
+ *
+ * Reports median CPU time (building vertices + upload + draw submission),
+ * median GPU time of the draw, and bytes streamed per frame.
+ *
+ * Usage: bench_quads [FRAMES]   (default 200 per case)
+ */
+
+int main(int argc, char **argv) {
+	unsigned int frames = 200;
+	if (argc == 2) {
+		frames = std::max(1UL, std::strtoul(argv[1], nullptr, 10));
+	} else if (argc != 1) {
+		std::cerr << "Usage:\n\t" << argv[0] << " [FRAMES]" << std::endl;
+		return 1;
+	}
+
+	SDL_Init(SDL_INIT_VIDEO);
+	SDL_GL_ResetAttributes();
+	SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
+	SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
+	SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 3);
+	SDL_Window *window = SDL_CreateWindow("bench_quads", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, 64, 64, SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN);
+	if (!window) {
+		std::cerr << "Error creating SDL window: " << SDL_GetError() << std::endl;
+		return 1;
+	}
+	SDL_GLContext context = SDL_GL_CreateContext(window);
+	if (!context) {
+		SDL_DestroyWindow(window);
+		std::cerr << "Error creating OpenGL context: " << SDL_GetError() << std::endl;
+		return 1;
+	}
+	#ifdef _WIN32
+	if (!init_gl_shims()) {
+		std::cerr << "ERROR: failed to initialize shims." << std::endl;
+		return 1;
+	}
+	#endif
+
+	{ //(GL objects are released at the end of this block, before the context)
+		//offscreen target (a hidden window's framebuffer may not be rendered at all):
+		glm::uvec2 const size = glm::uvec2(1024, 1024);
+		GLuint color = 0, fb = 0;
+		glGenRenderbuffers(1, &color);
+		glBindRenderbuffer(GL_RENDERBUFFER, color);
+		glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, size.x, size.y);
+		glGenFramebuffers(1, &fb);
+		glBindFramebuffer(GL_FRAMEBUFFER, fb);
+		glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, color);
+		if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+			std::cerr << "Offscreen framebuffer is incomplete." << std::endl;
+			return 1;
+		}
+		glViewport(0, 0, size.x, size.y);
+		glEnable(GL_BLEND);
+		glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+
+		//same fragment work for every path:
+		std::string const fragment_source =
+			"#version 330\n"
+			"in vec2 texCoord;\n"
+			"in vec4 color;\n"
+			"out vec4 fragColor;\n"
+			"void main() {\n"
+			"	fragColor = vec4(texCoord, 1.0, 1.0) * color;\n"
+			"}\n";
+
+		//per-vertex quads (strip and indexed paths), laid out like the game's old Vertex:
+		struct Vertex {
+			Vertex() = default;
+			Vertex(glm::vec2 const &Position_, glm::vec2 const &TexCoord_, glm::u8vec4 const &Color_) :
+				Position(Position_), TexCoord(TexCoord_), Color(Color_) { }
+			glm::vec2 Position;
+			glm::vec2 TexCoord;
+			glm::u8vec4 Color;
+		};
+		static_assert(sizeof(Vertex) == 20, "Vertex is nicely packed.");
+
+		GLuint vertex_program = link_program(compile_shader(GL_FRAGMENT_SHADER, fragment_source), compile_shader(GL_VERTEX_SHADER,
+			"#version 330\n"
+			"in vec4 Position;\n"
+			"in vec2 TexCoord;\n"
+			"in vec4 Color;\n"
+			"out vec2 texCoord;\n"
+			"out vec4 color;\n"
+			"void main() {\n"
+			"	gl_Position = Position;\n"
+			"	texCoord = TexCoord;\n"
+			"	color = Color;\n"
+			"}\n"
+		));
+		GLuint vertex_Position = glGetAttribLocation(vertex_program, "Position");
+		GLuint vertex_TexCoord = glGetAttribLocation(vertex_program, "TexCoord");
+		GLuint vertex_Color = glGetAttribLocation(vertex_program, "Color");
+
+		//per-instance quads (instanced path), laid out like the game's Sprite (rotated, with a rectangle of the atlas):
+		struct Instance {
+			glm::vec2 At;
+			glm::vec2 Radius;
+			float Angle;
+			glm::u16vec4 UVRect; //(min uv, max uv), normalized
+			glm::u8vec4 Color;
+		};
+		static_assert(sizeof(Instance) == 32, "Instance is nicely packed.");
+
+		//(the game's sprite vertex shader, minus the camera transform)
+		GLuint instance_program = link_program(compile_shader(GL_FRAGMENT_SHADER, fragment_source), compile_shader(GL_VERTEX_SHADER,
+			"#version 330\n"
+			"in vec2 Corner;\n"
+			"in vec2 At;\n"
+			"in vec2 Radius;\n"
+			"in float Angle;\n"
+			"in vec4 UVRect;\n"
+			"in vec4 Color;\n"
+			"out vec2 texCoord;\n"
+			"out vec4 color;\n"
+			"void main() {\n"
+			"	vec2 right = vec2(cos(Angle), sin(Angle));\n"
+			"	vec2 up = vec2(-right.y, right.x);\n"
+			"	vec2 local = Corner * Radius;\n"
+			"	gl_Position = vec4(At + right * local.x + up * local.y, 0.0, 1.0);\n"
+			"	color = Color;\n"
+			"	texCoord = mix(UVRect.xy, UVRect.zw, 0.5 * Corner + 0.5);\n"
+			"}\n"
+		));
+		GLuint instance_Corner = glGetAttribLocation(instance_program, "Corner");
+		GLuint instance_At = glGetAttribLocation(instance_program, "At");
+		GLuint instance_Radius = glGetAttribLocation(instance_program, "Radius");
+		GLuint instance_Angle = glGetAttribLocation(instance_program, "Angle");
+		GLuint instance_UVRect = glGetAttribLocation(instance_program, "UVRect");
+		GLuint instance_Color = glGetAttribLocation(instance_program, "Color");
+
+		//quads to draw (small, so the test is about vertex work rather than fill):
+		static const uint32_t MaxQuads = 100000;
+		std::vector< Instance > quads(MaxQuads);
+		uint32_t state = 0x12345678;
+		auto random = [&state]() {
+			state ^= state << 13;
+			state ^= state >> 17;
+			state ^= state << 5;
+			return state;
+		};
+		for (auto &q : quads) {
+			q.At = glm::vec2((random() % 2048) / 1024.0f - 1.0f, (random() % 2048) / 1024.0f - 1.0f);
+			q.Radius = glm::vec2(0.004f);
+			q.Angle = (random() % 6283) / 1000.0f;
+			//a random rectangle, like one sprite's spot in an atlas:
+			uint16_t x = uint16_t(random() % 60000), y = uint16_t(random() % 60000);
+			q.UVRect = glm::u16vec4(x, y, x + 4096, y + 4096);
+			q.Color = glm::u8vec4(random() & 0xff, random() & 0xff, random() & 0xff, 0xff);
+		}
+
+		std::unique_ptr< VertexRing > vertex_ring(new VertexRing(sizeof(Vertex) * 6 * MaxQuads, sizeof(Vertex)));
+		std::unique_ptr< VertexRing > instance_ring(new VertexRing(sizeof(Instance) * MaxQuads, sizeof(Instance)));
+		std::unique_ptr< QuadIndices > quad_indices(new QuadIndices());
+		std::unique_ptr< GpuTimer > gpu_timer(new GpuTimer(1));
+
+		GlState gl_state;
+
+		GLuint vertex_vao = 0;
+		glGenVertexArrays(1, &vertex_vao);
+		gl_state.bind_vertex_array(vertex_vao);
+		glBindBuffer(GL_ARRAY_BUFFER, vertex_ring->buffer);
+		glVertexAttribPointer(vertex_Position, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (GLbyte *)0 + offsetof(Vertex, Position));
+		glVertexAttribPointer(vertex_TexCoord, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (GLbyte *)0 + offsetof(Vertex, TexCoord));
+		glVertexAttribPointer(vertex_Color, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), (GLbyte *)0 + offsetof(Vertex, Color));
+		glEnableVertexAttribArray(vertex_Position);
+		glEnableVertexAttribArray(vertex_TexCoord);
+		glEnableVertexAttribArray(vertex_Color);
+		quad_indices->attach();
+		gl_state.bind_vertex_array(0);
+
+		glm::vec2 const corners[4] = {
+			glm::vec2(-1.0f,-1.0f),
+			glm::vec2(-1.0f, 1.0f),
+			glm::vec2( 1.0f,-1.0f),
+			glm::vec2( 1.0f, 1.0f),
+		};
+		std::unique_ptr< StaticMesh > unit_quad(new StaticMesh(corners, sizeof(corners), 4, [&](){
+			glVertexAttribPointer(instance_Corner, 2, GL_FLOAT, GL_FALSE, sizeof(glm::vec2), (GLbyte *)0);
+			glEnableVertexAttribArray(instance_Corner);
+			for (GLuint attrib : { instance_At, instance_Radius, instance_Angle, instance_UVRect, instance_Color }) {
+				glVertexAttribDivisor(attrib, 1);
+				glEnableVertexAttribArray(attrib);
+			}
+		}, gl_state));
+
+		//helper: write the four corners of quad 'q' (in strip order) to 'out', doing on the CPU what the instanced path's vertex shader does:
+		auto corners_of = [](Instance const &q, Vertex *out) {
+			glm::vec2 right = glm::vec2(std::cos(q.Angle), std::sin(q.Angle)) * q.Radius.x;
+			glm::vec2 up = glm::vec2(-std::sin(q.Angle), std::cos(q.Angle)) * q.Radius.y;
+			glm::vec2 min_uv = glm::vec2(q.UVRect.x / 65535.0f, q.UVRect.y / 65535.0f);
+			glm::vec2 max_uv = glm::vec2(q.UVRect.z / 65535.0f, q.UVRect.w / 65535.0f);
+			out[0] = Vertex(q.At - right - up, glm::vec2(min_uv.x, min_uv.y), q.Color);
+			out[1] = Vertex(q.At - right + up, glm::vec2(min_uv.x, max_uv.y), q.Color);
+			out[2] = Vertex(q.At + right - up, glm::vec2(max_uv.x, min_uv.y), q.Color);
+			out[3] = Vertex(q.At + right + up, glm::vec2(max_uv.x, max_uv.y), q.Color);
+		};
+
+		//each path builds, uploads, and draws 'count' quads; returns bytes streamed:
+		struct Path {
+			char const *name;
+			std::function< size_t(uint32_t count) > frame;
+		};
+		std::vector< Path > paths{
+			{ "strip", [&](uint32_t count) {
+				Vertex *out = reinterpret_cast< Vertex * >(vertex_ring->map(sizeof(Vertex) * 6 * count));
+				Vertex quad[4];
+				for (uint32_t i = 0; i < count; ++i) {
+					corners_of(quads[i], quad);
+					out[0] = quad[0]; out[1] = quad[0];
+					out[2] = quad[1];
+					out[3] = quad[2];
+					out[4] = quad[3]; out[5] = quad[3];
+					out += 6;
+				}
+				GLint first = GLint(vertex_ring->unmap(sizeof(Vertex) * 6 * count) / sizeof(Vertex));
+				gl_state.use_program(vertex_program);
+				gl_state.bind_vertex_array(vertex_vao);
+				gpu_timer->begin(0);
+				glDrawArrays(GL_TRIANGLE_STRIP, first, GLsizei(6 * count));
+				gpu_timer->end();
+				vertex_ring->fence();
+				return sizeof(Vertex) * 6 * count;
+			} },
+			{ "indexed", [&](uint32_t count) {
+				Vertex *out = reinterpret_cast< Vertex * >(vertex_ring->map(sizeof(Vertex) * 4 * count));
+				for (uint32_t i = 0; i < count; ++i) {
+					corners_of(quads[i], out);
+					out += 4;
+				}
+				GLint first = GLint(vertex_ring->unmap(sizeof(Vertex) * 4 * count) / sizeof(Vertex));
+				gl_state.use_program(vertex_program);
+				gl_state.bind_vertex_array(vertex_vao);
+				gpu_timer->begin(0);
+				quad_indices->draw(first, count);
+				gpu_timer->end();
+				vertex_ring->fence();
+				return sizeof(Vertex) * 4 * count;
+			} },
+			{ "instanced", [&](uint32_t count) {
+				Instance *out = reinterpret_cast< Instance * >(instance_ring->map(sizeof(Instance) * count));
+				for (uint32_t i = 0; i < count; ++i) {
+					out[i] = quads[i];
+				}
+				GLintptr offset = instance_ring->unmap(sizeof(Instance) * count);
+				gl_state.use_program(instance_program);
+				gl_state.bind_vertex_array(unit_quad->vao);
+				glBindBuffer(GL_ARRAY_BUFFER, instance_ring->buffer);
+				glVertexAttribPointer(instance_At, 2, GL_FLOAT, GL_FALSE, sizeof(Instance), (GLbyte *)0 + offset + offsetof(Instance, At));
+				glVertexAttribPointer(instance_Radius, 2, GL_FLOAT, GL_FALSE, sizeof(Instance), (GLbyte *)0 + offset + offsetof(Instance, Radius));
+				glVertexAttribPointer(instance_Angle, 1, GL_FLOAT, GL_FALSE, sizeof(Instance), (GLbyte *)0 + offset + offsetof(Instance, Angle));
+				glVertexAttribPointer(instance_UVRect, 4, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(Instance), (GLbyte *)0 + offset + offsetof(Instance, UVRect));
+				glVertexAttribPointer(instance_Color, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Instance), (GLbyte *)0 + offset + offsetof(Instance, Color));
+				gpu_timer->begin(0);
+				glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, unit_quad->count, GLsizei(count));
+				gpu_timer->end();
+				instance_ring->fence();
+				return sizeof(Instance) * count;
+			} },
+		};
+
+		auto median = [](std::vector< double > &values) {
+			if (values.empty()) return 0.0;
+			std::nth_element(values.begin(), values.begin() + values.size() / 2, values.end());
+			return values[values.size() / 2];
+		};
+
+		std::cout << "Median of " << frames << " frames per case (CPU: build + upload + submit; GPU: draw):" << std::endl;
+		for (uint32_t count : { 1000U, 10000U, 100000U }) {
+			for (auto const &path : paths) {
+				std::vector< double > cpu_ms, gpu_ms;
+				size_t bytes = 0;
+				static const unsigned int Warmup = 10;
+				for (unsigned int f = 0; f < Warmup + frames + GpuTimer::Frames; ++f) {
+					bool measure = (f >= Warmup && f < Warmup + frames);
+					gpu_timer->begin_frame();
+					//(GPU results trail by a couple of frames, so a few extra frames collect the last ones)
+					if (gpu_timer->ready && f >= Warmup + GpuTimer::Frames) gpu_ms.emplace_back(gpu_timer->pass_ms[0]);
+					glClear(GL_COLOR_BUFFER_BIT);
+					auto before = std::chrono::high_resolution_clock::now();
+					bytes = path.frame(count);
+					auto after = std::chrono::high_resolution_clock::now();
+					gpu_timer->end_frame();
+					glFlush();
+					if (measure) cpu_ms.emplace_back(std::chrono::duration< double, std::milli >(after - before).count());
+				}
+				glFinish();
+				std::cout << "  " << count << " quads, " << path.name << ": "
+					<< median(cpu_ms) << "ms CPU, "
+					<< median(gpu_ms) << "ms GPU (" << gpu_ms.size() << " samples), "
+					<< bytes / 1024 << "KiB/frame" << std::endl;
+			}
+		}
+
+		glDeleteVertexArrays(1, &vertex_vao);
+		glDeleteProgram(vertex_program);
+		glDeleteProgram(instance_program);
+		glDeleteFramebuffers(1, &fb);
+		glDeleteRenderbuffers(1, &color);
+	}
+
+	SDL_GL_DeleteContext(context);
+	SDL_DestroyWindow(window);
+	SDL_Quit();
+	return 0;
+}
@@ -0,0 +1,41 @@
+#include "camera_uniforms.hpp"
+
+#include <stdexcept>
+
+static_assert(sizeof(CameraUniforms::Block) == 2 * 64, "Camera block should match std140 layout.");
+
+char const *const CameraUniforms::GLSL =
+	"layout(std140) uniform Camera {\n"
+	"	mat4 world_to_clip;\n"
+	"	mat4 clip_to_world;\n"
+	"};\n";
+
+CameraUniforms::CameraUniforms() {
+	glGenBuffers(1, &buffer);
+	glBindBuffer(GL_UNIFORM_BUFFER, buffer);
+	glBufferData(GL_UNIFORM_BUFFER, sizeof(Block), NULL, GL_DYNAMIC_DRAW);
+	glBindBuffer(GL_UNIFORM_BUFFER, 0);
+	//(binding points are global state, so this stays put for the life of the buffer)
+	glBindBufferBase(GL_UNIFORM_BUFFER, Binding, buffer);
+}
+
+CameraUniforms::~CameraUniforms() {
+	glDeleteBuffers(1, &buffer);
+}
+
+void CameraUniforms::set(glm::mat4 const &world_to_clip) {
+	if (uploaded && block.world_to_clip == world_to_clip) return;
+	block.world_to_clip = world_to_clip;
+	block.clip_to_world = glm::inverse(world_to_clip);
+	glBindBuffer(GL_UNIFORM_BUFFER, buffer);
+	glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(Block), &block);
+	glBindBuffer(GL_UNIFORM_BUFFER, 0);
+	uploaded = true;
+	++uploads;
+}
+
+void CameraUniforms::bind_block(GLuint program) {
+	GLuint index = glGetUniformBlockIndex(program, "Camera");
+	if (index == GL_INVALID_INDEX) throw std::runtime_error("no uniform block named Camera");
+	glUniformBlockBinding(program, index, Binding);
+}
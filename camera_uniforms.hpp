@@ -0,0 +1,44 @@
+#pragma once
+
+#include "GL.hpp"
+
+#include <glm/glm.hpp>
+
+/*
+ * View data shared by every program, kept in one std140 uniform buffer that
+ * stays bound to binding point 'Binding'. A program declares the block by
+ * including CameraUniforms::GLSL in its source, and attaches it to the
+ * buffer with bind_block().
+ *
+ * The buffer is rewritten only when the view actually changes, so setting
+ * the same view every frame costs a comparison rather than an upload.
+ */
+
+struct CameraUniforms {
+	CameraUniforms();
+	~CameraUniforms();
+	CameraUniforms(CameraUniforms const &) = delete;
+	CameraUniforms &operator=(CameraUniforms const &) = delete;
+
+	//set the view; uploads only if it differs from the current one:
+	void set(glm::mat4 const &world_to_clip);
+
+	//attach 'program''s Camera block to the buffer (throws if the program doesn't use the block):
+	static void bind_block(GLuint program);
+
+	//block declaration for shader source:
+	static char const *const GLSL;
+
+	static const GLuint Binding = 0; //uniform buffer binding point
+
+	//std140 block contents (two mat4s: already tightly packed):
+	struct Block {
+		glm::mat4 world_to_clip;
+		glm::mat4 clip_to_world;
+	};
+
+	GLuint buffer = 0;
+	Block block;
+	bool uploaded = false; //buffer holds 'block'
+	uint32_t uploads = 0; //times the buffer was rewritten
+};
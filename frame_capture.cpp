@@ -0,0 +1,147 @@
+#include "frame_capture.hpp"
+
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#endif
+
+FrameCapture::FrameCapture(std::string const &directory_, ThreadPool *pool_) : directory(directory_), pool(pool_) {
+	#ifdef _WIN32
+	_mkdir(directory.c_str());
+	#else
+	mkdir(directory.c_str(), 0755);
+	#endif
+	writer_thread = std::thread(&FrameCapture::writer, this);
+}
+
+FrameCapture::~FrameCapture() {
+	poll(true);
+	for (auto &slot : slots) {
+		glDeleteBuffers(1, &slot.buffer);
+	}
+	{
+		std::unique_lock< std::mutex > lock(mutex);
+		quit = true;
+	}
+	frames_available.notify_all();
+	writer_thread.join();
+}
+
+bool FrameCapture::capture(std::string const &name, GLsizei width, GLsizei height) {
+	//find a free slot, allocating another if all are in flight:
+	unsigned int index = slots.size();
+	for (unsigned int s = 0; s < slots.size(); ++s) {
+		if (!slots[s].fence) {
+			index = s;
+			break;
+		}
+	}
+	if (index == slots.size()) {
+		if (slots.size() >= MaxInFlight) {
+			++dropped;
+			return false;
+		}
+		slots.emplace_back();
+		glGenBuffers(1, &slots.back().buffer);
+	}
+	Slot &slot = slots[index];
+
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+	if (slot.width != width || slot.height != height) {
+		glBufferData(GL_PIXEL_PACK_BUFFER, GLsizeiptr(width) * height * 4, NULL, GL_STREAM_READ);
+		slot.width = width;
+		slot.height = height;
+	}
+	glPixelStorei(GL_PACK_ALIGNMENT, 4);
+	glReadBuffer(GL_BACK);
+	//(with a pack buffer bound, this only queues the copy; the 'data' argument is an offset into the buffer)
+	glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, (GLbyte *)0);
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+	slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	slot.name = name;
+	in_flight.emplace_back(index);
+	return true;
+}
+
+void FrameCapture::poll(bool wait) {
+	//readbacks complete in order, so stop at the first one that isn't done:
+	while (!in_flight.empty()) {
+		Slot &slot = slots[in_flight.front()];
+		GLenum result = glClientWaitSync(slot.fence, (wait ? GL_SYNC_FLUSH_COMMANDS_BIT : 0), (wait ? 1000000000ULL : 0));
+		if (result == GL_TIMEOUT_EXPIRED) {
+			if (wait) continue;
+			break;
+		}
+		if (result == GL_WAIT_FAILED) throw std::runtime_error("glClientWaitSync failed on frame capture fence");
+		glDeleteSync(slot.fence);
+		slot.fence = 0;
+		in_flight.pop_front();
+
+		//each queued frame holds a full copy of the pixels, so when the writer falls behind,
+		// drop frames here (or, when waiting, wait for it) instead of queueing without bound:
+		bool full = false;
+		{
+			std::unique_lock< std::mutex > lock(mutex);
+			if (wait) frame_taken.wait(lock, [this](){ return frames.size() < MaxQueued; });
+			full = (frames.size() >= MaxQueued);
+		}
+		if (full) {
+			++dropped;
+			continue;
+		}
+
+		Frame frame;
+		frame.path = directory + "/" + slot.name;
+		frame.width = slot.width;
+		frame.height = slot.height;
+		frame.pixels.resize(size_t(slot.width) * slot.height);
+
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+		uint32_t const *mapped = reinterpret_cast< uint32_t const * >(glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, frame.pixels.size() * 4, GL_MAP_READ_BIT));
+		if (mapped) {
+			//copy out (so the buffer can be reused right away), making the image opaque:
+			//(framebuffer alpha is whatever blending left behind, not meaningful in a screenshot)
+			for (size_t i = 0; i < frame.pixels.size(); ++i) {
+				frame.pixels[i] = mapped[i] | 0xff000000;
+			}
+			glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+		}
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+		if (!mapped) {
+			std::cerr << "WARNING: failed to map readback of '" << frame.path << "'; skipping it." << std::endl;
+			++dropped;
+			continue;
+		}
+
+		{
+			std::unique_lock< std::mutex > lock(mutex);
+			frames.emplace_back(std::move(frame));
+		}
+		frames_available.notify_one();
+		++written;
+	}
+}
+
+void FrameCapture::writer() {
+	while (true) {
+		Frame frame;
+		{
+			std::unique_lock< std::mutex > lock(mutex);
+			frames_available.wait(lock, [this](){ return quit || !frames.empty(); });
+			//(drain the queue before quitting, so nothing captured is lost)
+			if (frames.empty()) return;
+			frame = std::move(frames.front());
+			frames.pop_front();
+		}
+		frame_taken.notify_one();
+		if (!save_png(frame.path, frame.width, frame.height, &frame.pixels[0], LowerLeftOrigin, options, pool)) {
+			std::cerr << "WARNING: failed to write '" << frame.path << "'." << std::endl;
+		}
+	}
+}
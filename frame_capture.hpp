@@ -0,0 +1,82 @@
+#pragma once
+
+#include "GL.hpp"
+#include "png_encode.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+ * Asynchronous screenshots and frame recording.
+ *
+ * capture() starts a glReadPixels of the back buffer into one of a ring of
+ * pixel-pack buffers and places a fence; poll() later maps whichever
+ * readbacks the GPU has finished (never waiting on a fence) and hands the
+ * pixels to a background thread that writes them out as PNGs. So neither
+ * readback nor compression ever stalls the render loop.
+ *
+ * Usage (once per frame):
+ *   capture.poll();
+ *   ... draw ...
+ *   if (want_frame) capture.capture("name.png", width, height);
+ *   SDL_GL_SwapWindow(...);
+ */
+
+struct ThreadPool;
+
+struct FrameCapture {
+	//PNGs are written to 'directory' (created if needed); if 'pool' is given, each PNG is compressed in parallel on it:
+	FrameCapture(std::string const &directory, ThreadPool *pool = nullptr);
+	//finishes all outstanding readbacks and writes (so destroy before the GL context):
+	~FrameCapture();
+	FrameCapture(FrameCapture const &) = delete;
+	FrameCapture &operator=(FrameCapture const &) = delete;
+
+	//start reading back the lower-left width x height pixels of the back buffer, to be saved as 'name' in 'directory';
+	// returns false (dropping the frame) if every readback buffer is still in flight:
+	bool capture(std::string const &name, GLsizei width, GLsizei height);
+
+	//hand finished readbacks to the writer thread, dropping them if MaxQueued frames are already waiting to be written;
+	// pass 'wait' to block until every readback is done (and wait for queue space instead of dropping):
+	void poll(bool wait = false);
+
+	//readback buffers allocated as needed, up to this many frames in flight:
+	static const unsigned int MaxInFlight = 8;
+	//frames waiting for the writer thread (each holds a full copy of the pixels), at most:
+	static const unsigned int MaxQueued = 4;
+
+	std::string directory;
+	PngEncodeOptions options; //compression settings for written PNGs (set before the first capture)
+	uint32_t dropped = 0; //frames skipped because every readback buffer was busy or the write queue was full
+	uint32_t written = 0; //frames handed to the writer thread
+
+private:
+	struct Slot {
+		GLuint buffer = 0;
+		GLsync fence = 0;
+		GLsizei width = 0;
+		GLsizei height = 0;
+		std::string name;
+	};
+	std::vector< Slot > slots;
+	std::deque< unsigned int > in_flight; //slots with readbacks pending, oldest first
+
+	struct Frame {
+		std::string path;
+		GLsizei width = 0;
+		GLsizei height = 0;
+		std::vector< uint32_t > pixels;
+	};
+	void writer();
+	ThreadPool *pool = nullptr;
+	std::thread writer_thread;
+	std::mutex mutex; //guards 'frames' and 'quit'
+	std::condition_variable frames_available;
+	std::condition_variable frame_taken; //signalled when the writer removes a frame from 'frames'
+	std::deque< Frame > frames;
+	bool quit = false;
+};
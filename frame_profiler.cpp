@@ -0,0 +1,91 @@
+#include "frame_profiler.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+#include <vector>
+
+char const *FrameProfiler::phase_name(Phase phase) {
+	switch (phase) {
+		case EventPoll: return "events";
+		case Update: return "update";
+		case VertexBuild: return "vertices";
+		case Upload: return "upload";
+		case Draw: return "draw";
+		case Swap: return "swap";
+		default: return "?";
+	}
+}
+
+char const *FrameProfiler::gpu_pass_name(GpuPass pass) {
+	switch (pass) {
+		case GpuTilemap: return "tilemap";
+		case GpuSprites: return "sprites";
+		case GpuFrame: return "total";
+		default: return "?";
+	}
+}
+
+void FrameProfiler::end_frame() {
+	samples[recorded % Capacity] = sample;
+	++recorded;
+	sample = Sample();
+}
+
+void FrameProfiler::report(std::ostream &to) const {
+	uint64_t end = recorded;
+	uint64_t count = std::min< uint64_t >(end, Capacity);
+	if (count == 0) {
+		to << "No frames recorded." << std::endl;
+		return;
+	}
+
+	//one column per phase, plus the frame total:
+	std::vector< std::vector< float > > columns(Phases + 1);
+	for (auto &column : columns) column.reserve(size_t(count));
+	//one per GPU pass (only frames that have a time for it):
+	std::vector< std::vector< float > > gpu_columns(GpuPasses);
+	for (uint64_t i = end - count; i < end; ++i) {
+		Sample const &s = samples[i % Capacity];
+		float total = 0.0f;
+		for (uint32_t p = 0; p < Phases; ++p) {
+			columns[p].emplace_back(s.ms[p]);
+			total += s.ms[p];
+		}
+		columns[Phases].emplace_back(total);
+		for (uint32_t p = 0; p < GpuPasses; ++p) {
+			if (s.gpu_ms[p] >= 0.0f) gpu_columns[p].emplace_back(s.gpu_ms[p]);
+		}
+	}
+
+	auto percentile = [](std::vector< float > &values, float fraction) {
+		size_t n = std::min(values.size() - 1, size_t(fraction * values.size()));
+		std::nth_element(values.begin(), values.begin() + n, values.end());
+		return values[n];
+	};
+
+	auto row = [&to, &percentile](char const *name, std::vector< float > &values) {
+		to << std::setw(10) << name
+			<< std::setw(9) << percentile(values, 0.50f)
+			<< std::setw(9) << percentile(values, 0.95f)
+			<< std::setw(9) << percentile(values, 0.99f)
+			<< std::setw(9) << *std::max_element(values.begin(), values.end())
+			<< "\n";
+	};
+
+	std::ios::fmtflags flags = to.flags();
+	to << "Frame CPU time (ms) over the last " << count << " frames:\n";
+	to << std::setw(10) << "phase" << std::setw(9) << "p50" << std::setw(9) << "p95" << std::setw(9) << "p99" << std::setw(9) << "max" << "\n";
+	to << std::fixed << std::setprecision(3);
+	for (uint32_t p = 0; p <= Phases; ++p) {
+		row(p < Phases ? phase_name(Phase(p)) : "total", columns[p]);
+	}
+	if (!gpu_columns[GpuFrame].empty()) {
+		to << "GPU time (ms) over " << gpu_columns[GpuFrame].size() << " of those frames:\n";
+		for (uint32_t p = 0; p < GpuPasses; ++p) {
+			if (!gpu_columns[p].empty()) row(gpu_pass_name(GpuPass(p)), gpu_columns[p]);
+		}
+	}
+	to.flush();
+	to.flags(flags);
+}
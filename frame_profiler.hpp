@@ -0,0 +1,80 @@
+#pragma once
+
+#include <chrono>
+#include <iosfwd>
+#include <stdint.h>
+
+/*
+ * Per-frame CPU timing, broken down by phase of the main loop, kept for the
+ * last Capacity frames and summarized as percentiles.
+ *
+ * Usage (once per frame):
+ *   profiler.begin_frame();
+ *   ... poll events ...  profiler.mark(FrameProfiler::EventPoll);
+ *   ... update ...       profiler.mark(FrameProfiler::Update);
+ *   ...
+ *   profiler.end_frame();
+ *
+ * GPU time per draw pass (measured by a GpuTimer) can be attached to the
+ * same samples with gpu(); it arrives a couple of frames late, so it goes with
+ * whichever frame is in progress when it's available.
+ *
+ * Samples go into a fixed ring with no locks, so the profiler belongs to one
+ * thread: call report() from the same thread (the main loop) that records.
+ */
+
+struct FrameProfiler {
+	enum Phase {
+		EventPoll,
+		Update,
+		VertexBuild,
+		Upload,
+		Draw,
+		Swap,
+		Phases //(count)
+	};
+	static char const *phase_name(Phase phase);
+
+	enum GpuPass {
+		GpuTilemap,
+		GpuSprites,
+		GpuFrame, //(whole frame)
+		GpuPasses //(count)
+	};
+	static char const *gpu_pass_name(GpuPass pass);
+
+	//start timing a frame (discarding any frame begun but not ended):
+	void begin_frame() {
+		sample = Sample();
+		last = std::chrono::high_resolution_clock::now();
+	}
+	//attribute the time since the last mark (or begin_frame) to 'phase':
+	void mark(Phase phase) {
+		auto now = std::chrono::high_resolution_clock::now();
+		sample.ms[phase] += std::chrono::duration< float, std::milli >(now - last).count();
+		last = now;
+	}
+	//attribute 'ms' of GPU time to 'pass' in this frame:
+	void gpu(GpuPass pass, float ms) {
+		sample.gpu_ms[pass] = ms;
+	}
+	//record the frame:
+	void end_frame();
+
+	//write p50/p95/p99/max of each phase (and the frame total), then of each GPU pass, over the recorded frames:
+	void report(std::ostream &to) const;
+
+	static const uint32_t Capacity = 4096; //frames kept (power of two)
+
+	struct Sample {
+		float ms[Phases] = { 0.0f };
+		float gpu_ms[GpuPasses] = { -1.0f, -1.0f, -1.0f }; //(negative: no GPU time)
+	};
+
+private:
+	Sample sample; //frame in progress
+	std::chrono::high_resolution_clock::time_point last;
+
+	Sample samples[Capacity];
+	uint64_t recorded = 0; //frames ever recorded; samples[recorded % Capacity] is written next
+};
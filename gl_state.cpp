@@ -0,0 +1,151 @@
+#include "gl_state.hpp"
+
+#include <cassert>
+#include <cstring>
+#include <ostream>
+
+void GlState::enable(GLenum cap) {
+	for (auto &c : caps) {
+		if (c.first == cap) {
+			if (c.second) {
+				++elided;
+				return;
+			}
+			c.second = true;
+			glEnable(cap);
+			++issued;
+			return;
+		}
+	}
+	caps.emplace_back(cap, true);
+	glEnable(cap);
+	++issued;
+}
+
+void GlState::disable(GLenum cap) {
+	for (auto &c : caps) {
+		if (c.first == cap) {
+			if (!c.second) {
+				++elided;
+				return;
+			}
+			c.second = false;
+			glDisable(cap);
+			++issued;
+			return;
+		}
+	}
+	caps.emplace_back(cap, false);
+	glDisable(cap);
+	++issued;
+}
+
+void GlState::blend_func(GLenum src, GLenum dst) {
+	if (blend_known && blend_src == src && blend_dst == dst) {
+		++elided;
+		return;
+	}
+	blend_known = true;
+	blend_src = src;
+	blend_dst = dst;
+	glBlendFunc(src, dst);
+	++issued;
+}
+
+void GlState::use_program(GLuint program_) {
+	if (program_known && program == program_) {
+		++elided;
+		return;
+	}
+	program_known = true;
+	program = program_;
+	glUseProgram(program);
+	++issued;
+}
+
+void GlState::bind_vertex_array(GLuint vao_) {
+	if (vao_known && vao == vao_) {
+		++elided;
+		return;
+	}
+	vao_known = true;
+	vao = vao_;
+	glBindVertexArray(vao);
+	++issued;
+}
+
+void GlState::bind_texture(GLuint unit, GLuint texture) {
+	assert(unit < TextureUnits);
+	if (textures_known[unit] && textures[unit] == texture) {
+		++elided;
+		return;
+	}
+	if (!active_known || active != unit) {
+		active_texture(unit);
+	}
+	textures_known[unit] = true;
+	textures[unit] = texture;
+	glBindTexture(GL_TEXTURE_2D, texture);
+	++issued;
+}
+
+void GlState::active_texture(GLuint unit) {
+	assert(unit < TextureUnits);
+	if (active_known && active == unit) {
+		++elided;
+		return;
+	}
+	active_known = true;
+	active = unit;
+	glActiveTexture(GL_TEXTURE0 + unit);
+	++issued;
+}
+
+bool GlState::uniform_changed(GLint location, void const *data, size_t size) {
+	assert(program_known && "set a program before setting uniforms");
+	assert(size <= sizeof(Uniform::data));
+	Uniform &uniform = uniforms[(uint64_t(program) << 32) | uint32_t(location)];
+	if (uniform.size == size && std::memcmp(uniform.data, data, size) == 0) {
+		++elided;
+		return false;
+	}
+	uniform.size = size;
+	std::memcpy(uniform.data, data, size);
+	++issued;
+	return true;
+}
+
+void GlState::uniform1i(GLint location, GLint value) {
+	if (uniform_changed(location, &value, sizeof(value))) glUniform1i(location, value);
+}
+
+void GlState::uniform1ui(GLint location, GLuint value) {
+	if (uniform_changed(location, &value, sizeof(value))) glUniform1ui(location, value);
+}
+
+void GlState::uniform2fv(GLint location, GLfloat const *value) {
+	if (uniform_changed(location, value, 2 * sizeof(GLfloat))) glUniform2fv(location, 1, value);
+}
+
+void GlState::uniform_matrix4fv(GLint location, GLfloat const *value) {
+	if (uniform_changed(location, value, 16 * sizeof(GLfloat))) glUniformMatrix4fv(location, 1, GL_FALSE, value);
+}
+
+void GlState::invalidate() {
+	caps.clear();
+	blend_known = false;
+	program_known = false;
+	vao_known = false;
+	active_known = false;
+	for (GLuint u = 0; u < TextureUnits; ++u) {
+		textures_known[u] = false;
+	}
+	uniforms.clear();
+}
+
+void GlState::report(std::ostream &to) const {
+	uint64_t total = issued + elided;
+	to << "GL state cache: elided " << elided << " of " << total << " calls";
+	if (total) to << " (" << (100 * elided + total / 2) / total << "%)";
+	to << "." << std::endl;
+}
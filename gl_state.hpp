@@ -0,0 +1,74 @@
+#pragma once
+
+#include "GL.hpp"
+
+#include <iosfwd>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <stdint.h>
+
+/*
+ * Cache of a few pieces of GL state -- capabilities, blend function, program,
+ * vertex array, texture bindings, and uniform values -- that skips calls
+ * which wouldn't change anything. Redundant calls aren't free: the driver
+ * still validates (and often re-emits) state for each one.
+ *
+ * Everything starts out unknown, so the first call of each kind always goes
+ * through. The cache only knows about changes made through it, so code that
+ * binds tracked state takes a GlState & and binds through it -- including
+ * while creating objects (see StaticMesh and Tilemap). The rare code that
+ * can't (e.g., PixelUpload::finish, which binds the texture it fills) must
+ * be followed by invalidate().
+ */
+
+struct GlState {
+	void enable(GLenum cap);
+	void disable(GLenum cap);
+	void blend_func(GLenum src, GLenum dst);
+	void use_program(GLuint program);
+	void bind_vertex_array(GLuint vao);
+	//bind 'texture' to GL_TEXTURE_2D of texture unit 'unit' (changing the active unit only if needed):
+	void bind_texture(GLuint unit, GLuint texture);
+	//make 'unit' the active texture unit (e.g., to modify the texture bound there):
+	void active_texture(GLuint unit);
+
+	//uniforms of the current program (values are remembered per program, as GL does):
+	void uniform1i(GLint location, GLint value);
+	void uniform1ui(GLint location, GLuint value);
+	void uniform2fv(GLint location, GLfloat const *value);
+	void uniform_matrix4fv(GLint location, GLfloat const *value);
+
+	//forget everything (next call of each kind goes through):
+	void invalidate();
+
+	//write counts of issued and elided calls:
+	void report(std::ostream &to) const;
+
+	uint64_t issued = 0; //calls passed on to GL
+	uint64_t elided = 0; //calls skipped as redundant
+
+	static const GLuint TextureUnits = 16; //units tracked (at least this many exist in any GL 3.3 implementation)
+
+private:
+	//true (and remembers the new value) if uniform 'location' of the current program doesn't already hold 'size' bytes at 'data':
+	bool uniform_changed(GLint location, void const *data, size_t size);
+
+	std::vector< std::pair< GLenum, bool > > caps; //known capability states
+	bool blend_known = false;
+	GLenum blend_src = GL_ONE, blend_dst = GL_ZERO;
+	bool program_known = false;
+	GLuint program = 0;
+	bool vao_known = false;
+	GLuint vao = 0;
+	bool active_known = false;
+	GLuint active = 0; //active texture unit
+	bool textures_known[TextureUnits] = { false };
+	GLuint textures[TextureUnits] = { 0 };
+
+	struct Uniform {
+		size_t size = 0;
+		uint8_t data[64]; //(largest: a mat4)
+	};
+	std::unordered_map< uint64_t, Uniform > uniforms; //by (program << 32 | location)
+};
@@ -0,0 +1,94 @@
+//counters and reporting for the GL call tracing wrappers in gl_trace.hpp (only built into GL_TRACE builds):
+#ifdef GL_TRACE
+
+#define GL_TRACE_NAMES
+#include "GL.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+#include <vector>
+
+namespace gl_trace {
+
+Counts functions[Functions];
+Counts frame[Categories];
+
+//per-category totals over all recorded frames:
+static Counts totals[Categories];
+static uint64_t max_calls[Categories] = { 0 }; //most calls in one frame
+static Counts last[Categories]; //most recent frame
+static uint64_t frames = 0;
+
+char const *category_name(Category category) {
+	switch (category) {
+		case Bind: return "bind";
+		case Upload: return "upload";
+		case Draw: return "draw";
+		case State: return "state";
+		case Other: return "other";
+		default: return "?";
+	}
+}
+
+char const *function_name(Function function) {
+	return gl_trace_function_names[function];
+}
+
+void begin_frame() {
+	for (auto &c : frame) c = Counts();
+}
+
+void end_frame() {
+	for (uint32_t c = 0; c < Categories; ++c) {
+		totals[c].calls += frame[c].calls;
+		totals[c].ns += frame[c].ns;
+		max_calls[c] = std::max(max_calls[c], frame[c].calls);
+		last[c] = frame[c];
+		frame[c] = Counts();
+	}
+	++frames;
+}
+
+void report(std::ostream &to) {
+	std::ios::fmtflags flags = to.flags();
+	if (frames == 0) {
+		to << "No GL calls traced in frames yet.\n";
+	} else {
+		to << "GL calls per frame over " << frames << " frames:\n";
+		to << std::setw(10) << "category" << std::setw(10) << "calls" << std::setw(10) << "max" << std::setw(10) << "last" << std::setw(10) << "us" << "\n";
+		to << std::fixed << std::setprecision(1);
+		for (uint32_t c = 0; c < Categories; ++c) {
+			to << std::setw(10) << category_name(Category(c))
+				<< std::setw(10) << double(totals[c].calls) / frames
+				<< std::setw(10) << max_calls[c]
+				<< std::setw(10) << last[c].calls
+				<< std::setw(10) << double(totals[c].ns) / frames * 1e-3
+				<< "\n";
+		}
+	}
+
+	//most time-consuming functions since startup (including calls outside frames):
+	std::vector< uint32_t > order;
+	for (uint32_t f = 0; f < Functions; ++f) {
+		if (functions[f].calls) order.emplace_back(f);
+	}
+	std::sort(order.begin(), order.end(), [](uint32_t a, uint32_t b){ return functions[a].ns > functions[b].ns; });
+	if (order.size() > 10) order.resize(10);
+	to << "Most expensive GL functions since startup:\n";
+	to << std::setw(28) << "function" << std::setw(10) << "calls" << std::setw(10) << "total ms" << std::setw(10) << "us/call" << "\n";
+	to << std::fixed << std::setprecision(3);
+	for (uint32_t f : order) {
+		to << std::setw(28) << function_name(Function(f))
+			<< std::setw(10) << functions[f].calls
+			<< std::setw(10) << functions[f].ns * 1e-6
+			<< std::setw(10) << double(functions[f].ns) / functions[f].calls * 1e-3
+			<< "\n";
+	}
+	to.flush();
+	to.flags(flags);
+}
+
+} //namespace gl_trace
+
+#endif //GL_TRACE
@@ -0,0 +1,1447 @@
+#ifndef GL_TRACE_HPP
+#define GL_TRACE_HPP 1
+
+//generated by 'make-gl-shims.py --trace' -- do not edit.
+//Included by GL.hpp when built with GL_TRACE defined: every GL call then goes through a wrapper that
+// counts and times it. Without GL_TRACE, this header isn't included at all.
+//NOTE: counters aren't synchronized; make GL calls from one thread (as GL requires anyway).
+
+#include <chrono>
+#include <iosfwd>
+#include <stdint.h>
+
+namespace gl_trace {
+
+enum Category {
+	Bind, //binding objects (and ActiveTexture, UseProgram)
+	Upload, //buffer and texture data
+	Draw, //draws and clears
+	State, //fixed-function state, texture/sampler parameters, uniforms, attribute layout
+	Other,
+	Categories //(count)
+};
+char const *category_name(Category category);
+
+enum Function {
+	CullFace,
+	FrontFace,
+	Hint,
+	LineWidth,
+	PointSize,
+	PolygonMode,
+	Scissor,
+	TexParameterf,
+	TexParameterfv,
+	TexParameteri,
+	TexParameteriv,
+	TexImage1D,
+	TexImage2D,
+	DrawBuffer,
+	Clear,
+	ClearColor,
+	ClearStencil,
+	ClearDepth,
+	StencilMask,
+	ColorMask,
+	DepthMask,
+	Disable,
+	Enable,
+	Finish,
+	Flush,
+	BlendFunc,
+	LogicOp,
+	StencilFunc,
+	StencilOp,
+	DepthFunc,
+	PixelStoref,
+	PixelStorei,
+	ReadBuffer,
+	ReadPixels,
+	GetBooleanv,
+	GetDoublev,
+	GetError,
+	GetFloatv,
+	GetIntegerv,
+	GetString,
+	GetTexImage,
+	GetTexParameterfv,
+	GetTexParameteriv,
+	GetTexLevelParameterfv,
+	GetTexLevelParameteriv,
+	IsEnabled,
+	DepthRange,
+	Viewport,
+	DrawArrays,
+	DrawElements,
+	GetPointerv,
+	PolygonOffset,
+	CopyTexImage1D,
+	CopyTexImage2D,
+	CopyTexSubImage1D,
+	CopyTexSubImage2D,
+	TexSubImage1D,
+	TexSubImage2D,
+	BindTexture,
+	DeleteTextures,
+	GenTextures,
+	IsTexture,
+	DrawRangeElements,
+	TexImage3D,
+	TexSubImage3D,
+	CopyTexSubImage3D,
+	ActiveTexture,
+	SampleCoverage,
+	CompressedTexImage3D,
+	CompressedTexImage2D,
+	CompressedTexImage1D,
+	CompressedTexSubImage3D,
+	CompressedTexSubImage2D,
+	CompressedTexSubImage1D,
+	GetCompressedTexImage,
+	BlendFuncSeparate,
+	MultiDrawArrays,
+	MultiDrawElements,
+	PointParameterf,
+	PointParameterfv,
+	PointParameteri,
+	PointParameteriv,
+	BlendColor,
+	BlendEquation,
+	GenQueries,
+	DeleteQueries,
+	IsQuery,
+	BeginQuery,
+	EndQuery,
+	GetQueryiv,
+	GetQueryObjectiv,
+	GetQueryObjectuiv,
+	BindBuffer,
+	DeleteBuffers,
+	GenBuffers,
+	IsBuffer,
+	BufferData,
+	BufferSubData,
+	GetBufferSubData,
+	MapBuffer,
+	UnmapBuffer,
+	GetBufferParameteriv,
+	GetBufferPointerv,
+	BlendEquationSeparate,
+	DrawBuffers,
+	StencilOpSeparate,
+	StencilFuncSeparate,
+	StencilMaskSeparate,
+	AttachShader,
+	BindAttribLocation,
+	CompileShader,
+	CreateProgram,
+	CreateShader,
+	DeleteProgram,
+	DeleteShader,
+	DetachShader,
+	DisableVertexAttribArray,
+	EnableVertexAttribArray,
+	GetActiveAttrib,
+	GetActiveUniform,
+	GetAttachedShaders,
+	GetAttribLocation,
+	GetProgramiv,
+	GetProgramInfoLog,
+	GetShaderiv,
+	GetShaderInfoLog,
+	GetShaderSource,
+	GetUniformLocation,
+	GetUniformfv,
+	GetUniformiv,
+	GetVertexAttribdv,
+	GetVertexAttribfv,
+	GetVertexAttribiv,
+	GetVertexAttribPointerv,
+	IsProgram,
+	IsShader,
+	LinkProgram,
+	ShaderSource,
+	UseProgram,
+	Uniform1f,
+	Uniform2f,
+	Uniform3f,
+	Uniform4f,
+	Uniform1i,
+	Uniform2i,
+	Uniform3i,
+	Uniform4i,
+	Uniform1fv,
+	Uniform2fv,
+	Uniform3fv,
+	Uniform4fv,
+	Uniform1iv,
+	Uniform2iv,
+	Uniform3iv,
+	Uniform4iv,
+	UniformMatrix2fv,
+	UniformMatrix3fv,
+	UniformMatrix4fv,
+	ValidateProgram,
+	VertexAttrib1d,
+	VertexAttrib1dv,
+	VertexAttrib1f,
+	VertexAttrib1fv,
+	VertexAttrib1s,
+	VertexAttrib1sv,
+	VertexAttrib2d,
+	VertexAttrib2dv,
+	VertexAttrib2f,
+	VertexAttrib2fv,
+	VertexAttrib2s,
+	VertexAttrib2sv,
+	VertexAttrib3d,
+	VertexAttrib3dv,
+	VertexAttrib3f,
+	VertexAttrib3fv,
+	VertexAttrib3s,
+	VertexAttrib3sv,
+	VertexAttrib4Nbv,
+	VertexAttrib4Niv,
+	VertexAttrib4Nsv,
+	VertexAttrib4Nub,
+	VertexAttrib4Nubv,
+	VertexAttrib4Nuiv,
+	VertexAttrib4Nusv,
+	VertexAttrib4bv,
+	VertexAttrib4d,
+	VertexAttrib4dv,
+	VertexAttrib4f,
+	VertexAttrib4fv,
+	VertexAttrib4iv,
+	VertexAttrib4s,
+	VertexAttrib4sv,
+	VertexAttrib4ubv,
+	VertexAttrib4uiv,
+	VertexAttrib4usv,
+	VertexAttribPointer,
+	UniformMatrix2x3fv,
+	UniformMatrix3x2fv,
+	UniformMatrix2x4fv,
+	UniformMatrix4x2fv,
+	UniformMatrix3x4fv,
+	UniformMatrix4x3fv,
+	ColorMaski,
+	GetBooleani_v,
+	GetIntegeri_v,
+	Enablei,
+	Disablei,
+	IsEnabledi,
+	BeginTransformFeedback,
+	EndTransformFeedback,
+	BindBufferRange,
+	BindBufferBase,
+	TransformFeedbackVaryings,
+	GetTransformFeedbackVarying,
+	ClampColor,
+	BeginConditionalRender,
+	EndConditionalRender,
+	VertexAttribIPointer,
+	GetVertexAttribIiv,
+	GetVertexAttribIuiv,
+	VertexAttribI1i,
+	VertexAttribI2i,
+	VertexAttribI3i,
+	VertexAttribI4i,
+	VertexAttribI1ui,
+	VertexAttribI2ui,
+	VertexAttribI3ui,
+	VertexAttribI4ui,
+	VertexAttribI1iv,
+	VertexAttribI2iv,
+	VertexAttribI3iv,
+	VertexAttribI4iv,
+	VertexAttribI1uiv,
+	VertexAttribI2uiv,
+	VertexAttribI3uiv,
+	VertexAttribI4uiv,
+	VertexAttribI4bv,
+	VertexAttribI4sv,
+	VertexAttribI4ubv,
+	VertexAttribI4usv,
+	GetUniformuiv,
+	BindFragDataLocation,
+	GetFragDataLocation,
+	Uniform1ui,
+	Uniform2ui,
+	Uniform3ui,
+	Uniform4ui,
+	Uniform1uiv,
+	Uniform2uiv,
+	Uniform3uiv,
+	Uniform4uiv,
+	TexParameterIiv,
+	TexParameterIuiv,
+	GetTexParameterIiv,
+	GetTexParameterIuiv,
+	ClearBufferiv,
+	ClearBufferuiv,
+	ClearBufferfv,
+	ClearBufferfi,
+	GetStringi,
+	IsRenderbuffer,
+	BindRenderbuffer,
+	DeleteRenderbuffers,
+	GenRenderbuffers,
+	RenderbufferStorage,
+	GetRenderbufferParameteriv,
+	IsFramebuffer,
+	BindFramebuffer,
+	DeleteFramebuffers,
+	GenFramebuffers,
+	CheckFramebufferStatus,
+	FramebufferTexture1D,
+	FramebufferTexture2D,
+	FramebufferTexture3D,
+	FramebufferRenderbuffer,
+	GetFramebufferAttachmentParameteriv,
+	GenerateMipmap,
+	BlitFramebuffer,
+	RenderbufferStorageMultisample,
+	FramebufferTextureLayer,
+	MapBufferRange,
+	FlushMappedBufferRange,
+	BindVertexArray,
+	DeleteVertexArrays,
+	GenVertexArrays,
+	IsVertexArray,
+	DrawArraysInstanced,
+	DrawElementsInstanced,
+	TexBuffer,
+	PrimitiveRestartIndex,
+	CopyBufferSubData,
+	GetUniformIndices,
+	GetActiveUniformsiv,
+	GetActiveUniformName,
+	GetUniformBlockIndex,
+	GetActiveUniformBlockiv,
+	GetActiveUniformBlockName,
+	UniformBlockBinding,
+	DrawElementsBaseVertex,
+	DrawRangeElementsBaseVertex,
+	DrawElementsInstancedBaseVertex,
+	MultiDrawElementsBaseVertex,
+	ProvokingVertex,
+	FenceSync,
+	IsSync,
+	DeleteSync,
+	ClientWaitSync,
+	WaitSync,
+	GetInteger64v,
+	GetSynciv,
+	GetInteger64i_v,
+	GetBufferParameteri64v,
+	FramebufferTexture,
+	TexImage2DMultisample,
+	TexImage3DMultisample,
+	GetMultisamplefv,
+	SampleMaski,
+	BindFragDataLocationIndexed,
+	GetFragDataIndex,
+	GenSamplers,
+	DeleteSamplers,
+	IsSampler,
+	BindSampler,
+	SamplerParameteri,
+	SamplerParameteriv,
+	SamplerParameterf,
+	SamplerParameterfv,
+	SamplerParameterIiv,
+	SamplerParameterIuiv,
+	GetSamplerParameteriv,
+	GetSamplerParameterIiv,
+	GetSamplerParameterfv,
+	GetSamplerParameterIuiv,
+	QueryCounter,
+	GetQueryObjecti64v,
+	GetQueryObjectui64v,
+	VertexAttribDivisor,
+	VertexAttribP1ui,
+	VertexAttribP1uiv,
+	VertexAttribP2ui,
+	VertexAttribP2uiv,
+	VertexAttribP3ui,
+	VertexAttribP3uiv,
+	VertexAttribP4ui,
+	VertexAttribP4uiv,
+	Functions //(count)
+};
+char const *function_name(Function function);
+
+struct Counts {
+	uint64_t calls = 0;
+	uint64_t ns = 0; //time spent in calls
+};
+extern Counts functions[Functions]; //since startup
+extern Counts frame[Categories]; //since begin_frame()
+
+//forget calls made since the last frame (e.g., while idle or starting up):
+void begin_frame();
+//add this frame's per-category totals to the history:
+void end_frame();
+//write per-frame category totals and the most expensive functions:
+void report(std::ostream &to);
+
+struct Scope {
+	Scope(Function function_, Category category_) : function(function_), category(category_), start(std::chrono::high_resolution_clock::now()) { }
+	~Scope() {
+		uint64_t ns = uint64_t(std::chrono::duration_cast< std::chrono::nanoseconds >(std::chrono::high_resolution_clock::now() - start).count());
+		functions[function].calls += 1;
+		functions[function].ns += ns;
+		frame[category].calls += 1;
+		frame[category].ns += ns;
+	}
+	Function function;
+	Category category;
+	std::chrono::high_resolution_clock::time_point start;
+};
+
+} //namespace gl_trace
+
+inline void trace_glCullFace(GLenum mode) { gl_trace::Scope scope(gl_trace::CullFace, gl_trace::State); glCullFace(mode); }
+#define glCullFace trace_glCullFace
+inline void trace_glFrontFace(GLenum mode) { gl_trace::Scope scope(gl_trace::FrontFace, gl_trace::State); glFrontFace(mode); }
+#define glFrontFace trace_glFrontFace
+inline void trace_glHint(GLenum target, GLenum mode) { gl_trace::Scope scope(gl_trace::Hint, gl_trace::State); glHint(target, mode); }
+#define glHint trace_glHint
+inline void trace_glLineWidth(GLfloat width) { gl_trace::Scope scope(gl_trace::LineWidth, gl_trace::State); glLineWidth(width); }
+#define glLineWidth trace_glLineWidth
+inline void trace_glPointSize(GLfloat size) { gl_trace::Scope scope(gl_trace::PointSize, gl_trace::State); glPointSize(size); }
+#define glPointSize trace_glPointSize
+inline void trace_glPolygonMode(GLenum face, GLenum mode) { gl_trace::Scope scope(gl_trace::PolygonMode, gl_trace::State); glPolygonMode(face, mode); }
+#define glPolygonMode trace_glPolygonMode
+inline void trace_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) { gl_trace::Scope scope(gl_trace::Scissor, gl_trace::State); glScissor(x, y, width, height); }
+#define glScissor trace_glScissor
+inline void trace_glTexParameterf(GLenum target, GLenum pname, GLfloat param) { gl_trace::Scope scope(gl_trace::TexParameterf, gl_trace::State); glTexParameterf(target, pname, param); }
+#define glTexParameterf trace_glTexParameterf
+inline void trace_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) { gl_trace::Scope scope(gl_trace::TexParameterfv, gl_trace::State); glTexParameterfv(target, pname, params); }
+#define glTexParameterfv trace_glTexParameterfv
+inline void trace_glTexParameteri(GLenum target, GLenum pname, GLint param) { gl_trace::Scope scope(gl_trace::TexParameteri, gl_trace::State); glTexParameteri(target, pname, param); }
+#define glTexParameteri trace_glTexParameteri
+inline void trace_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) { gl_trace::Scope scope(gl_trace::TexParameteriv, gl_trace::State); glTexParameteriv(target, pname, params); }
+#define glTexParameteriv trace_glTexParameteriv
+inline void trace_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) { gl_trace::Scope scope(gl_trace::TexImage1D, gl_trace::Upload); glTexImage1D(target, level, internalformat, width, border, format, type, pixels); }
+#define glTexImage1D trace_glTexImage1D
+inline void trace_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) { gl_trace::Scope scope(gl_trace::TexImage2D, gl_trace::Upload); glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels); }
+#define glTexImage2D trace_glTexImage2D
+inline void trace_glDrawBuffer(GLenum buf) { gl_trace::Scope scope(gl_trace::DrawBuffer, gl_trace::Draw); glDrawBuffer(buf); }
+#define glDrawBuffer trace_glDrawBuffer
+inline void trace_glClear(GLbitfield mask) { gl_trace::Scope scope(gl_trace::Clear, gl_trace::Draw); glClear(mask); }
+#define glClear trace_glClear
+inline void trace_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { gl_trace::Scope scope(gl_trace::ClearColor, gl_trace::State); glClearColor(red, green, blue, alpha); }
+#define glClearColor trace_glClearColor
+inline void trace_glClearStencil(GLint s) { gl_trace::Scope scope(gl_trace::ClearStencil, gl_trace::State); glClearStencil(s); }
+#define glClearStencil trace_glClearStencil
+inline void trace_glClearDepth(GLdouble depth) { gl_trace::Scope scope(gl_trace::ClearDepth, gl_trace::State); glClearDepth(depth); }
+#define glClearDepth trace_glClearDepth
+inline void trace_glStencilMask(GLuint mask) { gl_trace::Scope scope(gl_trace::StencilMask, gl_trace::State); glStencilMask(mask); }
+#define glStencilMask trace_glStencilMask
+inline void trace_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) { gl_trace::Scope scope(gl_trace::ColorMask, gl_trace::State); glColorMask(red, green, blue, alpha); }
+#define glColorMask trace_glColorMask
+inline void trace_glDepthMask(GLboolean flag) { gl_trace::Scope scope(gl_trace::DepthMask, gl_trace::State); glDepthMask(flag); }
+#define glDepthMask trace_glDepthMask
+inline void trace_glDisable(GLenum cap) { gl_trace::Scope scope(gl_trace::Disable, gl_trace::State); glDisable(cap); }
+#define glDisable trace_glDisable
+inline void trace_glEnable(GLenum cap) { gl_trace::Scope scope(gl_trace::Enable, gl_trace::State); glEnable(cap); }
+#define glEnable trace_glEnable
+inline void trace_glFinish(void) { gl_trace::Scope scope(gl_trace::Finish, gl_trace::Other); glFinish(); }
+#define glFinish trace_glFinish
+inline void trace_glFlush(void) { gl_trace::Scope scope(gl_trace::Flush, gl_trace::Other); glFlush(); }
+#define glFlush trace_glFlush
+inline void trace_glBlendFunc(GLenum sfactor, GLenum dfactor) { gl_trace::Scope scope(gl_trace::BlendFunc, gl_trace::State); glBlendFunc(sfactor, dfactor); }
+#define glBlendFunc trace_glBlendFunc
+inline void trace_glLogicOp(GLenum opcode) { gl_trace::Scope scope(gl_trace::LogicOp, gl_trace::State); glLogicOp(opcode); }
+#define glLogicOp trace_glLogicOp
+inline void trace_glStencilFunc(GLenum func, GLint ref, GLuint mask) { gl_trace::Scope scope(gl_trace::StencilFunc, gl_trace::State); glStencilFunc(func, ref, mask); }
+#define glStencilFunc trace_glStencilFunc
+inline void trace_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) { gl_trace::Scope scope(gl_trace::StencilOp, gl_trace::State); glStencilOp(fail, zfail, zpass); }
+#define glStencilOp trace_glStencilOp
+inline void trace_glDepthFunc(GLenum func) { gl_trace::Scope scope(gl_trace::DepthFunc, gl_trace::State); glDepthFunc(func); }
+#define glDepthFunc trace_glDepthFunc
+inline void trace_glPixelStoref(GLenum pname, GLfloat param) { gl_trace::Scope scope(gl_trace::PixelStoref, gl_trace::State); glPixelStoref(pname, param); }
+#define glPixelStoref trace_glPixelStoref
+inline void trace_glPixelStorei(GLenum pname, GLint param) { gl_trace::Scope scope(gl_trace::PixelStorei, gl_trace::State); glPixelStorei(pname, param); }
+#define glPixelStorei trace_glPixelStorei
+inline void trace_glReadBuffer(GLenum src) { gl_trace::Scope scope(gl_trace::ReadBuffer, gl_trace::Other); glReadBuffer(src); }
+#define glReadBuffer trace_glReadBuffer
+inline void trace_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) { gl_trace::Scope scope(gl_trace::ReadPixels, gl_trace::Other); glReadPixels(x, y, width, height, format, type, pixels); }
+#define glReadPixels trace_glReadPixels
+inline void trace_glGetBooleanv(GLenum pname, GLboolean *data) { gl_trace::Scope scope(gl_trace::GetBooleanv, gl_trace::Other); glGetBooleanv(pname, data); }
+#define glGetBooleanv trace_glGetBooleanv
+inline void trace_glGetDoublev(GLenum pname, GLdouble *data) { gl_trace::Scope scope(gl_trace::GetDoublev, gl_trace::Other); glGetDoublev(pname, data); }
+#define glGetDoublev trace_glGetDoublev
+inline GLenum trace_glGetError(void) { gl_trace::Scope scope(gl_trace::GetError, gl_trace::Other); return glGetError(); }
+#define glGetError trace_glGetError
+inline void trace_glGetFloatv(GLenum pname, GLfloat *data) { gl_trace::Scope scope(gl_trace::GetFloatv, gl_trace::Other); glGetFloatv(pname, data); }
+#define glGetFloatv trace_glGetFloatv
+inline void trace_glGetIntegerv(GLenum pname, GLint *data) { gl_trace::Scope scope(gl_trace::GetIntegerv, gl_trace::Other); glGetIntegerv(pname, data); }
+#define glGetIntegerv trace_glGetIntegerv
+inline const GLubyte * trace_glGetString(GLenum name) { gl_trace::Scope scope(gl_trace::GetString, gl_trace::Other); return glGetString(name); }
+#define glGetString trace_glGetString
+inline void trace_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) { gl_trace::Scope scope(gl_trace::GetTexImage, gl_trace::Other); glGetTexImage(target, level, format, type, pixels); }
+#define glGetTexImage trace_glGetTexImage
+inline void trace_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) { gl_trace::Scope scope(gl_trace::GetTexParameterfv, gl_trace::Other); glGetTexParameterfv(target, pname, params); }
+#define glGetTexParameterfv trace_glGetTexParameterfv
+inline void trace_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) { gl_trace::Scope scope(gl_trace::GetTexParameteriv, gl_trace::Other); glGetTexParameteriv(target, pname, params); }
+#define glGetTexParameteriv trace_glGetTexParameteriv
+inline void trace_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) { gl_trace::Scope scope(gl_trace::GetTexLevelParameterfv, gl_trace::Other); glGetTexLevelParameterfv(target, level, pname, params); }
+#define glGetTexLevelParameterfv trace_glGetTexLevelParameterfv
+inline void trace_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) { gl_trace::Scope scope(gl_trace::GetTexLevelParameteriv, gl_trace::Other); glGetTexLevelParameteriv(target, level, pname, params); }
+#define glGetTexLevelParameteriv trace_glGetTexLevelParameteriv
+inline GLboolean trace_glIsEnabled(GLenum cap) { gl_trace::Scope scope(gl_trace::IsEnabled, gl_trace::Other); return glIsEnabled(cap); }
+#define glIsEnabled trace_glIsEnabled
+inline void trace_glDepthRange(GLdouble near, GLdouble far) { gl_trace::Scope scope(gl_trace::DepthRange, gl_trace::State); glDepthRange(near, far); }
+#define glDepthRange trace_glDepthRange
+inline void trace_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) { gl_trace::Scope scope(gl_trace::Viewport, gl_trace::State); glViewport(x, y, width, height); }
+#define glViewport trace_glViewport
+inline void trace_glDrawArrays(GLenum mode, GLint first, GLsizei count) { gl_trace::Scope scope(gl_trace::DrawArrays, gl_trace::Draw); glDrawArrays(mode, first, count); }
+#define glDrawArrays trace_glDrawArrays
+inline void trace_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) { gl_trace::Scope scope(gl_trace::DrawElements, gl_trace::Draw); glDrawElements(mode, count, type, indices); }
+#define glDrawElements trace_glDrawElements
+inline void trace_glGetPointerv(GLenum pname, void **params) { gl_trace::Scope scope(gl_trace::GetPointerv, gl_trace::Other); glGetPointerv(pname, params); }
+#define glGetPointerv trace_glGetPointerv
+inline void trace_glPolygonOffset(GLfloat factor, GLfloat units) { gl_trace::Scope scope(gl_trace::PolygonOffset, gl_trace::State); glPolygonOffset(factor, units); }
+#define glPolygonOffset trace_glPolygonOffset
+inline void trace_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) { gl_trace::Scope scope(gl_trace::CopyTexImage1D, gl_trace::Other); glCopyTexImage1D(target, level, internalformat, x, y, width, border); }
+#define glCopyTexImage1D trace_glCopyTexImage1D
+inline void trace_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) { gl_trace::Scope scope(gl_trace::CopyTexImage2D, gl_trace::Other); glCopyTexImage2D(target, level, internalformat, x, y, width, height, border); }
+#define glCopyTexImage2D trace_glCopyTexImage2D
+inline void trace_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) { gl_trace::Scope scope(gl_trace::CopyTexSubImage1D, gl_trace::Other); glCopyTexSubImage1D(target, level, xoffset, x, y, width); }
+#define glCopyTexSubImage1D trace_glCopyTexSubImage1D
+inline void trace_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) { gl_trace::Scope scope(gl_trace::CopyTexSubImage2D, gl_trace::Other); glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height); }
+#define glCopyTexSubImage2D trace_glCopyTexSubImage2D
+inline void trace_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) { gl_trace::Scope scope(gl_trace::TexSubImage1D, gl_trace::Upload); glTexSubImage1D(target, level, xoffset, width, format, type, pixels); }
+#define glTexSubImage1D trace_glTexSubImage1D
+inline void trace_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) { gl_trace::Scope scope(gl_trace::TexSubImage2D, gl_trace::Upload); glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels); }
+#define glTexSubImage2D trace_glTexSubImage2D
+inline void trace_glBindTexture(GLenum target, GLuint texture) { gl_trace::Scope scope(gl_trace::BindTexture, gl_trace::Bind); glBindTexture(target, texture); }
+#define glBindTexture trace_glBindTexture
+inline void trace_glDeleteTextures(GLsizei n, const GLuint *textures) { gl_trace::Scope scope(gl_trace::DeleteTextures, gl_trace::Other); glDeleteTextures(n, textures); }
+#define glDeleteTextures trace_glDeleteTextures
+inline void trace_glGenTextures(GLsizei n, GLuint *textures) { gl_trace::Scope scope(gl_trace::GenTextures, gl_trace::Other); glGenTextures(n, textures); }
+#define glGenTextures trace_glGenTextures
+inline GLboolean trace_glIsTexture(GLuint texture) { gl_trace::Scope scope(gl_trace::IsTexture, gl_trace::Other); return glIsTexture(texture); }
+#define glIsTexture trace_glIsTexture
+inline void trace_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) { gl_trace::Scope scope(gl_trace::DrawRangeElements, gl_trace::Draw); glDrawRangeElements(mode, start, end, count, type, indices); }
+#define glDrawRangeElements trace_glDrawRangeElements
+inline void trace_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) { gl_trace::Scope scope(gl_trace::TexImage3D, gl_trace::Upload); glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels); }
+#define glTexImage3D trace_glTexImage3D
+inline void trace_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) { gl_trace::Scope scope(gl_trace::TexSubImage3D, gl_trace::Upload); glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels); }
+#define glTexSubImage3D trace_glTexSubImage3D
+inline void trace_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) { gl_trace::Scope scope(gl_trace::CopyTexSubImage3D, gl_trace::Other); glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height); }
+#define glCopyTexSubImage3D trace_glCopyTexSubImage3D
+inline void trace_glActiveTexture(GLenum texture) { gl_trace::Scope scope(gl_trace::ActiveTexture, gl_trace::Bind); glActiveTexture(texture); }
+#define glActiveTexture trace_glActiveTexture
+inline void trace_glSampleCoverage(GLfloat value, GLboolean invert) { gl_trace::Scope scope(gl_trace::SampleCoverage, gl_trace::State); glSampleCoverage(value, invert); }
+#define glSampleCoverage trace_glSampleCoverage
+inline void trace_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) { gl_trace::Scope scope(gl_trace::CompressedTexImage3D, gl_trace::Upload); glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data); }
+#define glCompressedTexImage3D trace_glCompressedTexImage3D
+inline void trace_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) { gl_trace::Scope scope(gl_trace::CompressedTexImage2D, gl_trace::Upload); glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data); }
+#define glCompressedTexImage2D trace_glCompressedTexImage2D
+inline void trace_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) { gl_trace::Scope scope(gl_trace::CompressedTexImage1D, gl_trace::Upload); glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data); }
+#define glCompressedTexImage1D trace_glCompressedTexImage1D
+inline void trace_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) { gl_trace::Scope scope(gl_trace::CompressedTexSubImage3D, gl_trace::Upload); glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data); }
+#define glCompressedTexSubImage3D trace_glCompressedTexSubImage3D
+inline void trace_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) { gl_trace::Scope scope(gl_trace::CompressedTexSubImage2D, gl_trace::Upload); glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data); }
+#define glCompressedTexSubImage2D trace_glCompressedTexSubImage2D
+inline void trace_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) { gl_trace::Scope scope(gl_trace::CompressedTexSubImage1D, gl_trace::Upload); glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data); }
+#define glCompressedTexSubImage1D trace_glCompressedTexSubImage1D
+inline void trace_glGetCompressedTexImage(GLenum target, GLint level, void *img) { gl_trace::Scope scope(gl_trace::GetCompressedTexImage, gl_trace::Other); glGetCompressedTexImage(target, level, img); }
+#define glGetCompressedTexImage trace_glGetCompressedTexImage
+inline void trace_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) { gl_trace::Scope scope(gl_trace::BlendFuncSeparate, gl_trace::State); glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha); }
+#define glBlendFuncSeparate trace_glBlendFuncSeparate
+inline void trace_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) { gl_trace::Scope scope(gl_trace::MultiDrawArrays, gl_trace::Draw); glMultiDrawArrays(mode, first, count, drawcount); }
+#define glMultiDrawArrays trace_glMultiDrawArrays
+inline void trace_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) { gl_trace::Scope scope(gl_trace::MultiDrawElements, gl_trace::Draw); glMultiDrawElements(mode, count, type, indices, drawcount); }
+#define glMultiDrawElements trace_glMultiDrawElements
+inline void trace_glPointParameterf(GLenum pname, GLfloat param) { gl_trace::Scope scope(gl_trace::PointParameterf, gl_trace::Other); glPointParameterf(pname, param); }
+#define glPointParameterf trace_glPointParameterf
+inline void trace_glPointParameterfv(GLenum pname, const GLfloat *params) { gl_trace::Scope scope(gl_trace::PointParameterfv, gl_trace::Other); glPointParameterfv(pname, params); }
+#define glPointParameterfv trace_glPointParameterfv
+inline void trace_glPointParameteri(GLenum pname, GLint param) { gl_trace::Scope scope(gl_trace::PointParameteri, gl_trace::Other); glPointParameteri(pname, param); }
+#define glPointParameteri trace_glPointParameteri
+inline void trace_glPointParameteriv(GLenum pname, const GLint *params) { gl_trace::Scope scope(gl_trace::PointParameteriv, gl_trace::Other); glPointParameteriv(pname, params); }
+#define glPointParameteriv trace_glPointParameteriv
+inline void trace_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { gl_trace::Scope scope(gl_trace::BlendColor, gl_trace::State); glBlendColor(red, green, blue, alpha); }
+#define glBlendColor trace_glBlendColor
+inline void trace_glBlendEquation(GLenum mode) { gl_trace::Scope scope(gl_trace::BlendEquation, gl_trace::State); glBlendEquation(mode); }
+#define glBlendEquation trace_glBlendEquation
+inline void trace_glGenQueries(GLsizei n, GLuint *ids) { gl_trace::Scope scope(gl_trace::GenQueries, gl_trace::Other); glGenQueries(n, ids); }
+#define glGenQueries trace_glGenQueries
+inline void trace_glDeleteQueries(GLsizei n, const GLuint *ids) { gl_trace::Scope scope(gl_trace::DeleteQueries, gl_trace::Other); glDeleteQueries(n, ids); }
+#define glDeleteQueries trace_glDeleteQueries
+inline GLboolean trace_glIsQuery(GLuint id) { gl_trace::Scope scope(gl_trace::IsQuery, gl_trace::Other); return glIsQuery(id); }
+#define glIsQuery trace_glIsQuery
+inline void trace_glBeginQuery(GLenum target, GLuint id) { gl_trace::Scope scope(gl_trace::BeginQuery, gl_trace::Other); glBeginQuery(target, id); }
+#define glBeginQuery trace_glBeginQuery
+inline void trace_glEndQuery(GLenum target) { gl_trace::Scope scope(gl_trace::EndQuery, gl_trace::Other); glEndQuery(target); }
+#define glEndQuery trace_glEndQuery
+inline void trace_glGetQueryiv(GLenum target, GLenum pname, GLint *params) { gl_trace::Scope scope(gl_trace::GetQueryiv, gl_trace::Other); glGetQueryiv(target, pname, params); }
+#define glGetQueryiv trace_glGetQueryiv
+inline void trace_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) { gl_trace::Scope scope(gl_trace::GetQueryObjectiv, gl_trace::Other); glGetQueryObjectiv(id, pname, params); }
+#define glGetQueryObjectiv trace_glGetQueryObjectiv
+inline void trace_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) { gl_trace::Scope scope(gl_trace::GetQueryObjectuiv, gl_trace::Other); glGetQueryObjectuiv(id, pname, params); }
+#define glGetQueryObjectuiv trace_glGetQueryObjectuiv
+inline void trace_glBindBuffer(GLenum target, GLuint buffer) { gl_trace::Scope scope(gl_trace::BindBuffer, gl_trace::Bind); glBindBuffer(target, buffer); }
+#define glBindBuffer trace_glBindBuffer
+inline void trace_glDeleteBuffers(GLsizei n, const GLuint *buffers) { gl_trace::Scope scope(gl_trace::DeleteBuffers, gl_trace::Other); glDeleteBuffers(n, buffers); }
+#define glDeleteBuffers trace_glDeleteBuffers
+inline void trace_glGenBuffers(GLsizei n, GLuint *buffers) { gl_trace::Scope scope(gl_trace::GenBuffers, gl_trace::Other); glGenBuffers(n, buffers); }
+#define glGenBuffers trace_glGenBuffers
+inline GLboolean trace_glIsBuffer(GLuint buffer) { gl_trace::Scope scope(gl_trace::IsBuffer, gl_trace::Other); return glIsBuffer(buffer); }
+#define glIsBuffer trace_glIsBuffer
+inline void trace_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) { gl_trace::Scope scope(gl_trace::BufferData, gl_trace::Upload); glBufferData(target, size, data, usage); }
+#define glBufferData trace_glBufferData
+inline void trace_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) { gl_trace::Scope scope(gl_trace::BufferSubData, gl_trace::Upload); glBufferSubData(target, offset, size, data); }
+#define glBufferSubData trace_glBufferSubData
+inline void trace_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) { gl_trace::Scope scope(gl_trace::GetBufferSubData, gl_trace::Other); glGetBufferSubData(target, offset, size, data); }
+#define glGetBufferSubData trace_glGetBufferSubData
+inline void * trace_glMapBuffer(GLenum target, GLenum access) { gl_trace::Scope scope(gl_trace::MapBuffer, gl_trace::Upload); return glMapBuffer(target, access); }
+#define glMapBuffer trace_glMapBuffer
+inline GLboolean trace_glUnmapBuffer(GLenum target) { gl_trace::Scope scope(gl_trace::UnmapBuffer, gl_trace::Upload); return glUnmapBuffer(target); }
+#define glUnmapBuffer trace_glUnmapBuffer
+inline void trace_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) { gl_trace::Scope scope(gl_trace::GetBufferParameteriv, gl_trace::Other); glGetBufferParameteriv(target, pname, params); }
+#define glGetBufferParameteriv trace_glGetBufferParameteriv
+inline void trace_glGetBufferPointerv(GLenum target, GLenum pname, void **params) { gl_trace::Scope scope(gl_trace::GetBufferPointerv, gl_trace::Other); glGetBufferPointerv(target, pname, params); }
+#define glGetBufferPointerv trace_glGetBufferPointerv
+inline void trace_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) { gl_trace::Scope scope(gl_trace::BlendEquationSeparate, gl_trace::State); glBlendEquationSeparate(modeRGB, modeAlpha); }
+#define glBlendEquationSeparate trace_glBlendEquationSeparate
+inline void trace_glDrawBuffers(GLsizei n, const GLenum *bufs) { gl_trace::Scope scope(gl_trace::DrawBuffers, gl_trace::Draw); glDrawBuffers(n, bufs); }
+#define glDrawBuffers trace_glDrawBuffers
+inline void trace_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) { gl_trace::Scope scope(gl_trace::StencilOpSeparate, gl_trace::State); glStencilOpSeparate(face, sfail, dpfail, dppass); }
+#define glStencilOpSeparate trace_glStencilOpSeparate
+inline void trace_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) { gl_trace::Scope scope(gl_trace::StencilFuncSeparate, gl_trace::State); glStencilFuncSeparate(face, func, ref, mask); }
+#define glStencilFuncSeparate trace_glStencilFuncSeparate
+inline void trace_glStencilMaskSeparate(GLenum face, GLuint mask) { gl_trace::Scope scope(gl_trace::StencilMaskSeparate, gl_trace::State); glStencilMaskSeparate(face, mask); }
+#define glStencilMaskSeparate trace_glStencilMaskSeparate
+inline void trace_glAttachShader(GLuint program, GLuint shader) { gl_trace::Scope scope(gl_trace::AttachShader, gl_trace::Other); glAttachShader(program, shader); }
+#define glAttachShader trace_glAttachShader
+inline void trace_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) { gl_trace::Scope scope(gl_trace::BindAttribLocation, gl_trace::Bind); glBindAttribLocation(program, index, name); }
+#define glBindAttribLocation trace_glBindAttribLocation
+inline void trace_glCompileShader(GLuint shader) { gl_trace::Scope scope(gl_trace::CompileShader, gl_trace::Other); glCompileShader(shader); }
+#define glCompileShader trace_glCompileShader
+inline GLuint trace_glCreateProgram(void) { gl_trace::Scope scope(gl_trace::CreateProgram, gl_trace::Other); return glCreateProgram(); }
+#define glCreateProgram trace_glCreateProgram
+inline GLuint trace_glCreateShader(GLenum type) { gl_trace::Scope scope(gl_trace::CreateShader, gl_trace::Other); return glCreateShader(type); }
+#define glCreateShader trace_glCreateShader
+inline void trace_glDeleteProgram(GLuint program) { gl_trace::Scope scope(gl_trace::DeleteProgram, gl_trace::Other); glDeleteProgram(program); }
+#define glDeleteProgram trace_glDeleteProgram
+inline void trace_glDeleteShader(GLuint shader) { gl_trace::Scope scope(gl_trace::DeleteShader, gl_trace::Other); glDeleteShader(shader); }
+#define glDeleteShader trace_glDeleteShader
+inline void trace_glDetachShader(GLuint program, GLuint shader) { gl_trace::Scope scope(gl_trace::DetachShader, gl_trace::Other); glDetachShader(program, shader); }
+#define glDetachShader trace_glDetachShader
+inline void trace_glDisableVertexAttribArray(GLuint index) { gl_trace::Scope scope(gl_trace::DisableVertexAttribArray, gl_trace::State); glDisableVertexAttribArray(index); }
+#define glDisableVertexAttribArray trace_glDisableVertexAttribArray
+inline void trace_glEnableVertexAttribArray(GLuint index) { gl_trace::Scope scope(gl_trace::EnableVertexAttribArray, gl_trace::State); glEnableVertexAttribArray(index); }
+#define glEnableVertexAttribArray trace_glEnableVertexAttribArray
+inline void trace_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) { gl_trace::Scope scope(gl_trace::GetActiveAttrib, gl_trace::Other); glGetActiveAttrib(program, index, bufSize, length, size, type, name); }
+#define glGetActiveAttrib trace_glGetActiveAttrib
+inline void trace_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) { gl_trace::Scope scope(gl_trace::GetActiveUniform, gl_trace::Other); glGetActiveUniform(program, index, bufSize, length, size, type, name); }
+#define glGetActiveUniform trace_glGetActiveUniform
+inline void trace_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) { gl_trace::Scope scope(gl_trace::GetAttachedShaders, gl_trace::Other); glGetAttachedShaders(program, maxCount, count, shaders); }
+#define glGetAttachedShaders trace_glGetAttachedShaders
+inline GLint trace_glGetAttribLocation(GLuint program, const GLchar *name) { gl_trace::Scope scope(gl_trace::GetAttribLocation, gl_trace::Other); return glGetAttribLocation(program, name); }
+#define glGetAttribLocation trace_glGetAttribLocation
+inline void trace_glGetProgramiv(GLuint program, GLenum pname, GLint *params) { gl_trace::Scope scope(gl_trace::GetProgramiv, gl_trace::Other); glGetProgramiv(program, pname, params); }
+#define glGetProgramiv trace_glGetProgramiv
+inline void trace_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) { gl_trace::Scope scope(gl_trace::GetProgramInfoLog, gl_trace::Other); glGetProgramInfoLog(program, bufSize, length, infoLog); }
+#define glGetProgramInfoLog trace_glGetProgramInfoLog
+inline void trace_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) { gl_trace::Scope scope(gl_trace::GetShaderiv, gl_trace::Other); glGetShaderiv(shader, pname, params); }
+#define glGetShaderiv trace_glGetShaderiv
+inline void trace_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) { gl_trace::Scope scope(gl_trace::GetShaderInfoLog, gl_trace::Other); glGetShaderInfoLog(shader, bufSize, length, infoLog); }
+#define glGetShaderInfoLog trace_glGetShaderInfoLog
+inline void trace_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) { gl_trace::Scope scope(gl_trace::GetShaderSource, gl_trace::Other); glGetShaderSource(shader, bufSize, length, source); }
+#define glGetShaderSource trace_glGetShaderSource
+inline GLint trace_glGetUniformLocation(GLuint program, const GLchar *name) { gl_trace::Scope scope(gl_trace::GetUniformLocation, gl_trace::Other); return glGetUniformLocation(program, name); }
+#define glGetUniformLocation trace_glGetUniformLocation
+inline void trace_glGetUniformfv(GLuint program, GLint location, GLfloat *params) { gl_trace::Scope scope(gl_trace::GetUniformfv, gl_trace::Other); glGetUniformfv(program, location, params); }
+#define glGetUniformfv trace_glGetUniformfv
+inline void trace_glGetUniformiv(GLuint program, GLint location, GLint *params) { gl_trace::Scope scope(gl_trace::GetUniformiv, gl_trace::Other); glGetUniformiv(program, location, params); }
+#define glGetUniformiv trace_glGetUniformiv
+inline void trace_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) { gl_trace::Scope scope(gl_trace::GetVertexAttribdv, gl_trace::Other); glGetVertexAttribdv(index, pname, params); }
+#define glGetVertexAttribdv trace_glGetVertexAttribdv
+inline void trace_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) { gl_trace::Scope scope(gl_trace::GetVertexAttribfv, gl_trace::Other); glGetVertexAttribfv(index, pname, params); }
+#define glGetVertexAttribfv trace_glGetVertexAttribfv
+inline void trace_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) { gl_trace::Scope scope(gl_trace::GetVertexAttribiv, gl_trace::Other); glGetVertexAttribiv(index, pname, params); }
+#define glGetVertexAttribiv trace_glGetVertexAttribiv
+inline void trace_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) { gl_trace::Scope scope(gl_trace::GetVertexAttribPointerv, gl_trace::Other); glGetVertexAttribPointerv(index, pname, pointer); }
+#define glGetVertexAttribPointerv trace_glGetVertexAttribPointerv
+inline GLboolean trace_glIsProgram(GLuint program) { gl_trace::Scope scope(gl_trace::IsProgram, gl_trace::Other); return glIsProgram(program); }
+#define glIsProgram trace_glIsProgram
+inline GLboolean trace_glIsShader(GLuint shader) { gl_trace::Scope scope(gl_trace::IsShader, gl_trace::Other); return glIsShader(shader); }
+#define glIsShader trace_glIsShader
+inline void trace_glLinkProgram(GLuint program) { gl_trace::Scope scope(gl_trace::LinkProgram, gl_trace::Other); glLinkProgram(program); }
+#define glLinkProgram trace_glLinkProgram
+inline void trace_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) { gl_trace::Scope scope(gl_trace::ShaderSource, gl_trace::Other); glShaderSource(shader, count, string, length); }
+#define glShaderSource trace_glShaderSource
+inline void trace_glUseProgram(GLuint program) { gl_trace::Scope scope(gl_trace::UseProgram, gl_trace::Bind); glUseProgram(program); }
+#define glUseProgram trace_glUseProgram
+inline void trace_glUniform1f(GLint location, GLfloat v0) { gl_trace::Scope scope(gl_trace::Uniform1f, gl_trace::State); glUniform1f(location, v0); }
+#define glUniform1f trace_glUniform1f
+inline void trace_glUniform2f(GLint location, GLfloat v0, GLfloat v1) { gl_trace::Scope scope(gl_trace::Uniform2f, gl_trace::State); glUniform2f(location, v0, v1); }
+#define glUniform2f trace_glUniform2f
+inline void trace_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) { gl_trace::Scope scope(gl_trace::Uniform3f, gl_trace::State); glUniform3f(location, v0, v1, v2); }
+#define glUniform3f trace_glUniform3f
+inline void trace_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) { gl_trace::Scope scope(gl_trace::Uniform4f, gl_trace::State); glUniform4f(location, v0, v1, v2, v3); }
+#define glUniform4f trace_glUniform4f
+inline void trace_glUniform1i(GLint location, GLint v0) { gl_trace::Scope scope(gl_trace::Uniform1i, gl_trace::State); glUniform1i(location, v0); }
+#define glUniform1i trace_glUniform1i
+inline void trace_glUniform2i(GLint location, GLint v0, GLint v1) { gl_trace::Scope scope(gl_trace::Uniform2i, gl_trace::State); glUniform2i(location, v0, v1); }
+#define glUniform2i trace_glUniform2i
+inline void trace_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) { gl_trace::Scope scope(gl_trace::Uniform3i, gl_trace::State); glUniform3i(location, v0, v1, v2); }
+#define glUniform3i trace_glUniform3i
+inline void trace_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) { gl_trace::Scope scope(gl_trace::Uniform4i, gl_trace::State); glUniform4i(location, v0, v1, v2, v3); }
+#define glUniform4i trace_glUniform4i
+inline void trace_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) { gl_trace::Scope scope(gl_trace::Uniform1fv, gl_trace::State); glUniform1fv(location, count, value); }
+#define glUniform1fv trace_glUniform1fv
+inline void trace_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) { gl_trace::Scope scope(gl_trace::Uniform2fv, gl_trace::State); glUniform2fv(location, count, value); }
+#define glUniform2fv trace_glUniform2fv
+inline void trace_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) { gl_trace::Scope scope(gl_trace::Uniform3fv, gl_trace::State); glUniform3fv(location, count, value); }
+#define glUniform3fv trace_glUniform3fv
+inline void trace_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) { gl_trace::Scope scope(gl_trace::Uniform4fv, gl_trace::State); glUniform4fv(location, count, value); }
+#define glUniform4fv trace_glUniform4fv
+inline void trace_glUniform1iv(GLint location, GLsizei count, const GLint *value) { gl_trace::Scope scope(gl_trace::Uniform1iv, gl_trace::State); glUniform1iv(location, count, value); }
+#define glUniform1iv trace_glUniform1iv
+inline void trace_glUniform2iv(GLint location, GLsizei count, const GLint *value) { gl_trace::Scope scope(gl_trace::Uniform2iv, gl_trace::State); glUniform2iv(location, count, value); }
+#define glUniform2iv trace_glUniform2iv
+inline void trace_glUniform3iv(GLint location, GLsizei count, const GLint *value) { gl_trace::Scope scope(gl_trace::Uniform3iv, gl_trace::State); glUniform3iv(location, count, value); }
+#define glUniform3iv trace_glUniform3iv
+inline void trace_glUniform4iv(GLint location, GLsizei count, const GLint *value) { gl_trace::Scope scope(gl_trace::Uniform4iv, gl_trace::State); glUniform4iv(location, count, value); }
+#define glUniform4iv trace_glUniform4iv
+inline void trace_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { gl_trace::Scope scope(gl_trace::UniformMatrix2fv, gl_trace::State); glUniformMatrix2fv(location, count, transpose, value); }
+#define glUniformMatrix2fv trace_glUniformMatrix2fv
+inline void trace_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { gl_trace::Scope scope(gl_trace::UniformMatrix3fv, gl_trace::State); glUniformMatrix3fv(location, count, transpose, value); }
+#define glUniformMatrix3fv trace_glUniformMatrix3fv
+inline void trace_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { gl_trace::Scope scope(gl_trace::UniformMatrix4fv, gl_trace::State); glUniformMatrix4fv(location, count, transpose, value); }
+#define glUniformMatrix4fv trace_glUniformMatrix4fv
+inline void trace_glValidateProgram(GLuint program) { gl_trace::Scope scope(gl_trace::ValidateProgram, gl_trace::Other); glValidateProgram(program); }
+#define glValidateProgram trace_glValidateProgram
+inline void trace_glVertexAttrib1d(GLuint index, GLdouble x) { gl_trace::Scope scope(gl_trace::VertexAttrib1d, gl_trace::Other); glVertexAttrib1d(index, x); }
+#define glVertexAttrib1d trace_glVertexAttrib1d
+inline void trace_glVertexAttrib1dv(GLuint index, const GLdouble *v) { gl_trace::Scope scope(gl_trace::VertexAttrib1dv, gl_trace::Other); glVertexAttrib1dv(index, v); }
+#define glVertexAttrib1dv trace_glVertexAttrib1dv
+inline void trace_glVertexAttrib1f(GLuint index, GLfloat x) { gl_trace::Scope scope(gl_trace::VertexAttrib1f, gl_trace::Other); glVertexAttrib1f(index, x); }
+#define glVertexAttrib1f trace_glVertexAttrib1f
+inline void trace_glVertexAttrib1fv(GLuint index, const GLfloat *v) { gl_trace::Scope scope(gl_trace::VertexAttrib1fv, gl_trace::Other); glVertexAttrib1fv(index, v); }
+#define glVertexAttrib1fv trace_glVertexAttrib1fv
+inline void trace_glVertexAttrib1s(GLuint index, GLshort x) { gl_trace::Scope scope(gl_trace::VertexAttrib1s, gl_trace::Other); glVertexAttrib1s(index, x); }
+#define glVertexAttrib1s trace_glVertexAttrib1s
+inline void trace_glVertexAttrib1sv(GLuint index, const GLshort *v) { gl_trace::Scope scope(gl_trace::VertexAttrib1sv, gl_trace::Other); glVertexAttrib1sv(index, v); }
+#define glVertexAttrib1sv trace_glVertexAttrib1sv
+inline void trace_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) { gl_trace::Scope scope(gl_trace::VertexAttrib2d, gl_trace::Other); glVertexAttrib2d(index, x, y); }
+#define glVertexAttrib2d trace_glVertexAttrib2d
+inline void trace_glVertexAttrib2dv(GLuint index, const GLdouble *v) { gl_trace::Scope scope(gl_trace::VertexAttrib2dv, gl_trace::Other); glVertexAttrib2dv(index, v); }
+#define glVertexAttrib2dv trace_glVertexAttrib2dv
+inline void trace_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) { gl_trace::Scope scope(gl_trace::VertexAttrib2f, gl_trace::Other); glVertexAttrib2f(index, x, y); }
+#define glVertexAttrib2f trace_glVertexAttrib2f
+inline void trace_glVertexAttrib2fv(GLuint index, const GLfloat *v) { gl_trace::Scope scope(gl_trace::VertexAttrib2fv, gl_trace::Other); glVertexAttrib2fv(index, v); }
+#define glVertexAttrib2fv trace_glVertexAttrib2fv
+inline void trace_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) { gl_trace::Scope scope(gl_trace::VertexAttrib2s, gl_trace::Other); glVertexAttrib2s(index, x, y); }
+#define glVertexAttrib2s trace_glVertexAttrib2s
+inline void trace_glVertexAttrib2sv(GLuint index, const GLshort *v) { gl_trace::Scope scope(gl_trace::VertexAttrib2sv, gl_trace::Other); glVertexAttrib2sv(index, v); }
+#define glVertexAttrib2sv trace_glVertexAttrib2sv
+inline void trace_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) { gl_trace::Scope scope(gl_trace::VertexAttrib3d, gl_trace::Other); glVertexAttrib3d(index, x, y, z); }
+#define glVertexAttrib3d trace_glVertexAttrib3d
+inline void trace_glVertexAttrib3dv(GLuint index, const GLdouble *v) { gl_trace::Scope scope(gl_trace::VertexAttrib3dv, gl_trace::Other); glVertexAttrib3dv(index, v); }
+#define glVertexAttrib3dv trace_glVertexAttrib3dv
+inline void trace_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) { gl_trace::Scope scope(gl_trace::VertexAttrib3f, gl_trace::Other); glVertexAttrib3f(index, x, y, z); }
+#define glVertexAttrib3f trace_glVertexAttrib3f
+inline void trace_glVertexAttrib3fv(GLuint index, const GLfloat *v) { gl_trace::Scope scope(gl_trace::VertexAttrib3fv, gl_trace::Other); glVertexAttrib3fv(index, v); }
+#define glVertexAttrib3fv trace_glVertexAttrib3fv
+inline void trace_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) { gl_trace::Scope scope(gl_trace::VertexAttrib3s, gl_trace::Other); glVertexAttrib3s(index, x, y, z); }
+#define glVertexAttrib3s trace_glVertexAttrib3s
+inline void trace_glVertexAttrib3sv(GLuint index, const GLshort *v) { gl_trace::Scope scope(gl_trace::VertexAttrib3sv, gl_trace::Other); glVertexAttrib3sv(index, v); }
+#define glVertexAttrib3sv trace_glVertexAttrib3sv
+inline void trace_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) { gl_trace::Scope scope(gl_trace::VertexAttrib4Nbv, gl_trace::Other); glVertexAttrib4Nbv(index, v); }
+#define glVertexAttrib4Nbv trace_glVertexAttrib4Nbv
+inline void trace_glVertexAttrib4Niv(GLuint index, const GLint *v) { gl_trace::Scope scope(gl_trace::VertexAttrib4Niv, gl_trace::Other); glVertexAttrib4Niv(index, v); }
+#define glVertexAttrib4Niv trace_glVertexAttrib4Niv
+inline void trace_glVertexAttrib4Nsv(GLuint index, const GLshort *v) { gl_trace::Scope scope(gl_trace::VertexAttrib4Nsv, gl_trace::Other); glVertexAttrib4Nsv(index, v); }
+#define glVertexAttrib4Nsv trace_glVertexAttrib4Nsv
+inline void trace_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) { gl_trace::Scope scope(gl_trace::VertexAttrib4Nub, gl_trace::Other); glVertexAttrib4Nub(index, x, y, z, w); }
+#define glVertexAttrib4Nub trace_glVertexAttrib4Nub
+inline void trace_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) { gl_trace::Scope scope(gl_trace::VertexAttrib4Nubv, gl_trace::Other); glVertexAttrib4Nubv(index, v); }
+#define glVertexAttrib4Nubv trace_glVertexAttrib4Nubv
+inline void trace_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) { gl_trace::Scope scope(gl_trace::VertexAttrib4Nuiv, gl_trace::Other); glVertexAttrib4Nuiv(index, v); }
+#define glVertexAttrib4Nuiv trace_glVertexAttrib4Nuiv
+inline void trace_glVertexAttrib4Nusv(GLuint index, const GLushort *v) { gl_trace::Scope scope(gl_trace::VertexAttrib4Nusv, gl_trace::Other); glVertexAttrib4Nusv(index, v); }
+#define glVertexAttrib4Nusv trace_glVertexAttrib4Nusv
+inline void trace_glVertexAttrib4bv(GLuint index, const GLbyte *v) { gl_trace::Scope scope(gl_trace::VertexAttrib4bv, gl_trace::Other); glVertexAttrib4bv(index, v); }
+#define glVertexAttrib4bv trace_glVertexAttrib4bv
+inline void trace_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) { gl_trace::Scope scope(gl_trace::VertexAttrib4d, gl_trace::Other); glVertexAttrib4d(index, x, y, z, w); }
+#define glVertexAttrib4d trace_glVertexAttrib4d
+inline void trace_glVertexAttrib4dv(GLuint index, const GLdouble *v) { gl_trace::Scope scope(gl_trace::VertexAttrib4dv, gl_trace::Other); glVertexAttrib4dv(index, v); }
+#define glVertexAttrib4dv trace_glVertexAttrib4dv
+inline void trace_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) { gl_trace::Scope scope(gl_trace::VertexAttrib4f, gl_trace::Other); glVertexAttrib4f(index, x, y, z, w); }
+#define glVertexAttrib4f trace_glVertexAttrib4f
+inline void trace_glVertexAttrib4fv(GLuint index, const GLfloat *v) { gl_trace::Scope scope(gl_trace::VertexAttrib4fv, gl_trace::Other); glVertexAttrib4fv(index, v); }
+#define glVertexAttrib4fv trace_glVertexAttrib4fv
+inline void trace_glVertexAttrib4iv(GLuint index, const GLint *v) { gl_trace::Scope scope(gl_trace::VertexAttrib4iv, gl_trace::Other); glVertexAttrib4iv(index, v); }
+#define glVertexAttrib4iv trace_glVertexAttrib4iv
+inline void trace_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) { gl_trace::Scope scope(gl_trace::VertexAttrib4s, gl_trace::Other); glVertexAttrib4s(index, x, y, z, w); }
+#define glVertexAttrib4s trace_glVertexAttrib4s
+inline void trace_glVertexAttrib4sv(GLuint index, const GLshort *v) { gl_trace::Scope scope(gl_trace::VertexAttrib4sv, gl_trace::Other); glVertexAttrib4sv(index, v); }
+#define glVertexAttrib4sv trace_glVertexAttrib4sv
+inline void trace_glVertexAttrib4ubv(GLuint index, const GLubyte *v) { gl_trace::Scope scope(gl_trace::VertexAttrib4ubv, gl_trace::Other); glVertexAttrib4ubv(index, v); }
+#define glVertexAttrib4ubv trace_glVertexAttrib4ubv
+inline void trace_glVertexAttrib4uiv(GLuint index, const GLuint *v) { gl_trace::Scope scope(gl_trace::VertexAttrib4uiv, gl_trace::Other); glVertexAttrib4uiv(index, v); }
+#define glVertexAttrib4uiv trace_glVertexAttrib4uiv
+inline void trace_glVertexAttrib4usv(GLuint index, const GLushort *v) { gl_trace::Scope scope(gl_trace::VertexAttrib4usv, gl_trace::Other); glVertexAttrib4usv(index, v); }
+#define glVertexAttrib4usv trace_glVertexAttrib4usv
+inline void trace_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) { gl_trace::Scope scope(gl_trace::VertexAttribPointer, gl_trace::State); glVertexAttribPointer(index, size, type, normalized, stride, pointer); }
+#define glVertexAttribPointer trace_glVertexAttribPointer
+inline void trace_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { gl_trace::Scope scope(gl_trace::UniformMatrix2x3fv, gl_trace::State); glUniformMatrix2x3fv(location, count, transpose, value); }
+#define glUniformMatrix2x3fv trace_glUniformMatrix2x3fv
+inline void trace_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { gl_trace::Scope scope(gl_trace::UniformMatrix3x2fv, gl_trace::State); glUniformMatrix3x2fv(location, count, transpose, value); }
+#define glUniformMatrix3x2fv trace_glUniformMatrix3x2fv
+inline void trace_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { gl_trace::Scope scope(gl_trace::UniformMatrix2x4fv, gl_trace::State); glUniformMatrix2x4fv(location, count, transpose, value); }
+#define glUniformMatrix2x4fv trace_glUniformMatrix2x4fv
+inline void trace_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { gl_trace::Scope scope(gl_trace::UniformMatrix4x2fv, gl_trace::State); glUniformMatrix4x2fv(location, count, transpose, value); }
+#define glUniformMatrix4x2fv trace_glUniformMatrix4x2fv
+inline void trace_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { gl_trace::Scope scope(gl_trace::UniformMatrix3x4fv, gl_trace::State); glUniformMatrix3x4fv(location, count, transpose, value); }
+#define glUniformMatrix3x4fv trace_glUniformMatrix3x4fv
+inline void trace_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { gl_trace::Scope scope(gl_trace::UniformMatrix4x3fv, gl_trace::State); glUniformMatrix4x3fv(location, count, transpose, value); }
+#define glUniformMatrix4x3fv trace_glUniformMatrix4x3fv
+inline void trace_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) { gl_trace::Scope scope(gl_trace::ColorMaski, gl_trace::State); glColorMaski(index, r, g, b, a); }
+#define glColorMaski trace_glColorMaski
+inline void trace_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) { gl_trace::Scope scope(gl_trace::GetBooleani_v, gl_trace::Other); glGetBooleani_v(target, index, data); }
+#define glGetBooleani_v trace_glGetBooleani_v
+inline void trace_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) { gl_trace::Scope scope(gl_trace::GetIntegeri_v, gl_trace::Other); glGetIntegeri_v(target, index, data); }
+#define glGetIntegeri_v trace_glGetIntegeri_v
+inline void trace_glEnablei(GLenum target, GLuint index) { gl_trace::Scope scope(gl_trace::Enablei, gl_trace::State); glEnablei(target, index); }
+#define glEnablei trace_glEnablei
+inline void trace_glDisablei(GLenum target, GLuint index) { gl_trace::Scope scope(gl_trace::Disablei, gl_trace::State); glDisablei(target, index); }
+#define glDisablei trace_glDisablei
+inline GLboolean trace_glIsEnabledi(GLenum target, GLuint index) { gl_trace::Scope scope(gl_trace::IsEnabledi, gl_trace::Other); return glIsEnabledi(target, index); }
+#define glIsEnabledi trace_glIsEnabledi
+inline void trace_glBeginTransformFeedback(GLenum primitiveMode) { gl_trace::Scope scope(gl_trace::BeginTransformFeedback, gl_trace::Other); glBeginTransformFeedback(primitiveMode); }
+#define glBeginTransformFeedback trace_glBeginTransformFeedback
+inline void trace_glEndTransformFeedback(void) { gl_trace::Scope scope(gl_trace::EndTransformFeedback, gl_trace::Other); glEndTransformFeedback(); }
+#define glEndTransformFeedback trace_glEndTransformFeedback
+inline void trace_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) { gl_trace::Scope scope(gl_trace::BindBufferRange, gl_trace::Bind); glBindBufferRange(target, index, buffer, offset, size); }
+#define glBindBufferRange trace_glBindBufferRange
+inline void trace_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) { gl_trace::Scope scope(gl_trace::BindBufferBase, gl_trace::Bind); glBindBufferBase(target, index, buffer); }
+#define glBindBufferBase trace_glBindBufferBase
+inline void trace_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) { gl_trace::Scope scope(gl_trace::TransformFeedbackVaryings, gl_trace::Other); glTransformFeedbackVaryings(program, count, varyings, bufferMode); }
+#define glTransformFeedbackVaryings trace_glTransformFeedbackVaryings
+inline void trace_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) { gl_trace::Scope scope(gl_trace::GetTransformFeedbackVarying, gl_trace::Other); glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name); }
+#define glGetTransformFeedbackVarying trace_glGetTransformFeedbackVarying
+inline void trace_glClampColor(GLenum target, GLenum clamp) { gl_trace::Scope scope(gl_trace::ClampColor, gl_trace::Other); glClampColor(target, clamp); }
+#define glClampColor trace_glClampColor
+inline void trace_glBeginConditionalRender(GLuint id, GLenum mode) { gl_trace::Scope scope(gl_trace::BeginConditionalRender, gl_trace::Other); glBeginConditionalRender(id, mode); }
+#define glBeginConditionalRender trace_glBeginConditionalRender
+inline void trace_glEndConditionalRender(void) { gl_trace::Scope scope(gl_trace::EndConditionalRender, gl_trace::Other); glEndConditionalRender(); }
+#define glEndConditionalRender trace_glEndConditionalRender
+inline void trace_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) { gl_trace::Scope scope(gl_trace::VertexAttribIPointer, gl_trace::State); glVertexAttribIPointer(index, size, type, stride, pointer); }
+#define glVertexAttribIPointer trace_glVertexAttribIPointer
+inline void trace_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) { gl_trace::Scope scope(gl_trace::GetVertexAttribIiv, gl_trace::Other); glGetVertexAttribIiv(index, pname, params); }
+#define glGetVertexAttribIiv trace_glGetVertexAttribIiv
+inline void trace_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) { gl_trace::Scope scope(gl_trace::GetVertexAttribIuiv, gl_trace::Other); glGetVertexAttribIuiv(index, pname, params); }
+#define glGetVertexAttribIuiv trace_glGetVertexAttribIuiv
+inline void trace_glVertexAttribI1i(GLuint index, GLint x) { gl_trace::Scope scope(gl_trace::VertexAttribI1i, gl_trace::Other); glVertexAttribI1i(index, x); }
+#define glVertexAttribI1i trace_glVertexAttribI1i
+inline void trace_glVertexAttribI2i(GLuint index, GLint x, GLint y) { gl_trace::Scope scope(gl_trace::VertexAttribI2i, gl_trace::Other); glVertexAttribI2i(index, x, y); }
+#define glVertexAttribI2i trace_glVertexAttribI2i
+inline void trace_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) { gl_trace::Scope scope(gl_trace::VertexAttribI3i, gl_trace::Other); glVertexAttribI3i(index, x, y, z); }
+#define glVertexAttribI3i trace_glVertexAttribI3i
+inline void trace_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) { gl_trace::Scope scope(gl_trace::VertexAttribI4i, gl_trace::Other); glVertexAttribI4i(index, x, y, z, w); }
+#define glVertexAttribI4i trace_glVertexAttribI4i
+inline void trace_glVertexAttribI1ui(GLuint index, GLuint x) { gl_trace::Scope scope(gl_trace::VertexAttribI1ui, gl_trace::Other); glVertexAttribI1ui(index, x); }
+#define glVertexAttribI1ui trace_glVertexAttribI1ui
+inline void trace_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) { gl_trace::Scope scope(gl_trace::VertexAttribI2ui, gl_trace::Other); glVertexAttribI2ui(index, x, y); }
+#define glVertexAttribI2ui trace_glVertexAttribI2ui
+inline void trace_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) { gl_trace::Scope scope(gl_trace::VertexAttribI3ui, gl_trace::Other); glVertexAttribI3ui(index, x, y, z); }
+#define glVertexAttribI3ui trace_glVertexAttribI3ui
+inline void trace_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) { gl_trace::Scope scope(gl_trace::VertexAttribI4ui, gl_trace::Other); glVertexAttribI4ui(index, x, y, z, w); }
+#define glVertexAttribI4ui trace_glVertexAttribI4ui
+inline void trace_glVertexAttribI1iv(GLuint index, const GLint *v) { gl_trace::Scope scope(gl_trace::VertexAttribI1iv, gl_trace::Other); glVertexAttribI1iv(index, v); }
+#define glVertexAttribI1iv trace_glVertexAttribI1iv
+inline void trace_glVertexAttribI2iv(GLuint index, const GLint *v) { gl_trace::Scope scope(gl_trace::VertexAttribI2iv, gl_trace::Other); glVertexAttribI2iv(index, v); }
+#define glVertexAttribI2iv trace_glVertexAttribI2iv
+inline void trace_glVertexAttribI3iv(GLuint index, const GLint *v) { gl_trace::Scope scope(gl_trace::VertexAttribI3iv, gl_trace::Other); glVertexAttribI3iv(index, v); }
+#define glVertexAttribI3iv trace_glVertexAttribI3iv
+inline void trace_glVertexAttribI4iv(GLuint index, const GLint *v) { gl_trace::Scope scope(gl_trace::VertexAttribI4iv, gl_trace::Other); glVertexAttribI4iv(index, v); }
+#define glVertexAttribI4iv trace_glVertexAttribI4iv
+inline void trace_glVertexAttribI1uiv(GLuint index, const GLuint *v) { gl_trace::Scope scope(gl_trace::VertexAttribI1uiv, gl_trace::Other); glVertexAttribI1uiv(index, v); }
+#define glVertexAttribI1uiv trace_glVertexAttribI1uiv
+inline void trace_glVertexAttribI2uiv(GLuint index, const GLuint *v) { gl_trace::Scope scope(gl_trace::VertexAttribI2uiv, gl_trace::Other); glVertexAttribI2uiv(index, v); }
+#define glVertexAttribI2uiv trace_glVertexAttribI2uiv
+inline void trace_glVertexAttribI3uiv(GLuint index, const GLuint *v) { gl_trace::Scope scope(gl_trace::VertexAttribI3uiv, gl_trace::Other); glVertexAttribI3uiv(index, v); }
+#define glVertexAttribI3uiv trace_glVertexAttribI3uiv
+inline void trace_glVertexAttribI4uiv(GLuint index, const GLuint *v) { gl_trace::Scope scope(gl_trace::VertexAttribI4uiv, gl_trace::Other); glVertexAttribI4uiv(index, v); }
+#define glVertexAttribI4uiv trace_glVertexAttribI4uiv
+inline void trace_glVertexAttribI4bv(GLuint index, const GLbyte *v) { gl_trace::Scope scope(gl_trace::VertexAttribI4bv, gl_trace::Other); glVertexAttribI4bv(index, v); }
+#define glVertexAttribI4bv trace_glVertexAttribI4bv
+inline void trace_glVertexAttribI4sv(GLuint index, const GLshort *v) { gl_trace::Scope scope(gl_trace::VertexAttribI4sv, gl_trace::Other); glVertexAttribI4sv(index, v); }
+#define glVertexAttribI4sv trace_glVertexAttribI4sv
+inline void trace_glVertexAttribI4ubv(GLuint index, const GLubyte *v) { gl_trace::Scope scope(gl_trace::VertexAttribI4ubv, gl_trace::Other); glVertexAttribI4ubv(index, v); }
+#define glVertexAttribI4ubv trace_glVertexAttribI4ubv
+inline void trace_glVertexAttribI4usv(GLuint index, const GLushort *v) { gl_trace::Scope scope(gl_trace::VertexAttribI4usv, gl_trace::Other); glVertexAttribI4usv(index, v); }
+#define glVertexAttribI4usv trace_glVertexAttribI4usv
+inline void trace_glGetUniformuiv(GLuint program, GLint location, GLuint *params) { gl_trace::Scope scope(gl_trace::GetUniformuiv, gl_trace::Other); glGetUniformuiv(program, location, params); }
+#define glGetUniformuiv trace_glGetUniformuiv
+inline void trace_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) { gl_trace::Scope scope(gl_trace::BindFragDataLocation, gl_trace::Bind); glBindFragDataLocation(program, color, name); }
+#define glBindFragDataLocation trace_glBindFragDataLocation
+inline GLint trace_glGetFragDataLocation(GLuint program, const GLchar *name) { gl_trace::Scope scope(gl_trace::GetFragDataLocation, gl_trace::Other); return glGetFragDataLocation(program, name); }
+#define glGetFragDataLocation trace_glGetFragDataLocation
+inline void trace_glUniform1ui(GLint location, GLuint v0) { gl_trace::Scope scope(gl_trace::Uniform1ui, gl_trace::State); glUniform1ui(location, v0); }
+#define glUniform1ui trace_glUniform1ui
+inline void trace_glUniform2ui(GLint location, GLuint v0, GLuint v1) { gl_trace::Scope scope(gl_trace::Uniform2ui, gl_trace::State); glUniform2ui(location, v0, v1); }
+#define glUniform2ui trace_glUniform2ui
+inline void trace_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) { gl_trace::Scope scope(gl_trace::Uniform3ui, gl_trace::State); glUniform3ui(location, v0, v1, v2); }
+#define glUniform3ui trace_glUniform3ui
+inline void trace_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) { gl_trace::Scope scope(gl_trace::Uniform4ui, gl_trace::State); glUniform4ui(location, v0, v1, v2, v3); }
+#define glUniform4ui trace_glUniform4ui
+inline void trace_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) { gl_trace::Scope scope(gl_trace::Uniform1uiv, gl_trace::State); glUniform1uiv(location, count, value); }
+#define glUniform1uiv trace_glUniform1uiv
+inline void trace_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) { gl_trace::Scope scope(gl_trace::Uniform2uiv, gl_trace::State); glUniform2uiv(location, count, value); }
+#define glUniform2uiv trace_glUniform2uiv
+inline void trace_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) { gl_trace::Scope scope(gl_trace::Uniform3uiv, gl_trace::State); glUniform3uiv(location, count, value); }
+#define glUniform3uiv trace_glUniform3uiv
+inline void trace_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) { gl_trace::Scope scope(gl_trace::Uniform4uiv, gl_trace::State); glUniform4uiv(location, count, value); }
+#define glUniform4uiv trace_glUniform4uiv
+inline void trace_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) { gl_trace::Scope scope(gl_trace::TexParameterIiv, gl_trace::State); glTexParameterIiv(target, pname, params); }
+#define glTexParameterIiv trace_glTexParameterIiv
+inline void trace_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) { gl_trace::Scope scope(gl_trace::TexParameterIuiv, gl_trace::State); glTexParameterIuiv(target, pname, params); }
+#define glTexParameterIuiv trace_glTexParameterIuiv
+inline void trace_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) { gl_trace::Scope scope(gl_trace::GetTexParameterIiv, gl_trace::Other); glGetTexParameterIiv(target, pname, params); }
+#define glGetTexParameterIiv trace_glGetTexParameterIiv
+inline void trace_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) { gl_trace::Scope scope(gl_trace::GetTexParameterIuiv, gl_trace::Other); glGetTexParameterIuiv(target, pname, params); }
+#define glGetTexParameterIuiv trace_glGetTexParameterIuiv
+inline void trace_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) { gl_trace::Scope scope(gl_trace::ClearBufferiv, gl_trace::Other); glClearBufferiv(buffer, drawbuffer, value); }
+#define glClearBufferiv trace_glClearBufferiv
+inline void trace_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) { gl_trace::Scope scope(gl_trace::ClearBufferuiv, gl_trace::Other); glClearBufferuiv(buffer, drawbuffer, value); }
+#define glClearBufferuiv trace_glClearBufferuiv
+inline void trace_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) { gl_trace::Scope scope(gl_trace::ClearBufferfv, gl_trace::Other); glClearBufferfv(buffer, drawbuffer, value); }
+#define glClearBufferfv trace_glClearBufferfv
+inline void trace_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) { gl_trace::Scope scope(gl_trace::ClearBufferfi, gl_trace::Other); glClearBufferfi(buffer, drawbuffer, depth, stencil); }
+#define glClearBufferfi trace_glClearBufferfi
+inline const GLubyte * trace_glGetStringi(GLenum name, GLuint index) { gl_trace::Scope scope(gl_trace::GetStringi, gl_trace::Other); return glGetStringi(name, index); }
+#define glGetStringi trace_glGetStringi
+inline GLboolean trace_glIsRenderbuffer(GLuint renderbuffer) { gl_trace::Scope scope(gl_trace::IsRenderbuffer, gl_trace::Other); return glIsRenderbuffer(renderbuffer); }
+#define glIsRenderbuffer trace_glIsRenderbuffer
+inline void trace_glBindRenderbuffer(GLenum target, GLuint renderbuffer) { gl_trace::Scope scope(gl_trace::BindRenderbuffer, gl_trace::Bind); glBindRenderbuffer(target, renderbuffer); }
+#define glBindRenderbuffer trace_glBindRenderbuffer
+inline void trace_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) { gl_trace::Scope scope(gl_trace::DeleteRenderbuffers, gl_trace::Other); glDeleteRenderbuffers(n, renderbuffers); }
+#define glDeleteRenderbuffers trace_glDeleteRenderbuffers
+inline void trace_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) { gl_trace::Scope scope(gl_trace::GenRenderbuffers, gl_trace::Other); glGenRenderbuffers(n, renderbuffers); }
+#define glGenRenderbuffers trace_glGenRenderbuffers
+inline void trace_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) { gl_trace::Scope scope(gl_trace::RenderbufferStorage, gl_trace::Other); glRenderbufferStorage(target, internalformat, width, height); }
+#define glRenderbufferStorage trace_glRenderbufferStorage
+inline void trace_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) { gl_trace::Scope scope(gl_trace::GetRenderbufferParameteriv, gl_trace::Other); glGetRenderbufferParameteriv(target, pname, params); }
+#define glGetRenderbufferParameteriv trace_glGetRenderbufferParameteriv
+inline GLboolean trace_glIsFramebuffer(GLuint framebuffer) { gl_trace::Scope scope(gl_trace::IsFramebuffer, gl_trace::Other); return glIsFramebuffer(framebuffer); }
+#define glIsFramebuffer trace_glIsFramebuffer
+inline void trace_glBindFramebuffer(GLenum target, GLuint framebuffer) { gl_trace::Scope scope(gl_trace::BindFramebuffer, gl_trace::Bind); glBindFramebuffer(target, framebuffer); }
+#define glBindFramebuffer trace_glBindFramebuffer
+inline void trace_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) { gl_trace::Scope scope(gl_trace::DeleteFramebuffers, gl_trace::Other); glDeleteFramebuffers(n, framebuffers); }
+#define glDeleteFramebuffers trace_glDeleteFramebuffers
+inline void trace_glGenFramebuffers(GLsizei n, GLuint *framebuffers) { gl_trace::Scope scope(gl_trace::GenFramebuffers, gl_trace::Other); glGenFramebuffers(n, framebuffers); }
+#define glGenFramebuffers trace_glGenFramebuffers
+inline GLenum trace_glCheckFramebufferStatus(GLenum target) { gl_trace::Scope scope(gl_trace::CheckFramebufferStatus, gl_trace::Other); return glCheckFramebufferStatus(target); }
+#define glCheckFramebufferStatus trace_glCheckFramebufferStatus
+inline void trace_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) { gl_trace::Scope scope(gl_trace::FramebufferTexture1D, gl_trace::Other); glFramebufferTexture1D(target, attachment, textarget, texture, level); }
+#define glFramebufferTexture1D trace_glFramebufferTexture1D
+inline void trace_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) { gl_trace::Scope scope(gl_trace::FramebufferTexture2D, gl_trace::Other); glFramebufferTexture2D(target, attachment, textarget, texture, level); }
+#define glFramebufferTexture2D trace_glFramebufferTexture2D
+inline void trace_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) { gl_trace::Scope scope(gl_trace::FramebufferTexture3D, gl_trace::Other); glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset); }
+#define glFramebufferTexture3D trace_glFramebufferTexture3D
+inline void trace_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) { gl_trace::Scope scope(gl_trace::FramebufferRenderbuffer, gl_trace::Other); glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer); }
+#define glFramebufferRenderbuffer trace_glFramebufferRenderbuffer
+inline void trace_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) { gl_trace::Scope scope(gl_trace::GetFramebufferAttachmentParameteriv, gl_trace::Other); glGetFramebufferAttachmentParameteriv(target, attachment, pname, params); }
+#define glGetFramebufferAttachmentParameteriv trace_glGetFramebufferAttachmentParameteriv
+inline void trace_glGenerateMipmap(GLenum target) { gl_trace::Scope scope(gl_trace::GenerateMipmap, gl_trace::Upload); glGenerateMipmap(target); }
+#define glGenerateMipmap trace_glGenerateMipmap
+inline void trace_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) { gl_trace::Scope scope(gl_trace::BlitFramebuffer, gl_trace::Other); glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter); }
+#define glBlitFramebuffer trace_glBlitFramebuffer
+inline void trace_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) { gl_trace::Scope scope(gl_trace::RenderbufferStorageMultisample, gl_trace::Other); glRenderbufferStorageMultisample(target, samples, internalformat, width, height); }
+#define glRenderbufferStorageMultisample trace_glRenderbufferStorageMultisample
+inline void trace_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) { gl_trace::Scope scope(gl_trace::FramebufferTextureLayer, gl_trace::Other); glFramebufferTextureLayer(target, attachment, texture, level, layer); }
+#define glFramebufferTextureLayer trace_glFramebufferTextureLayer
+inline void * trace_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) { gl_trace::Scope scope(gl_trace::MapBufferRange, gl_trace::Upload); return glMapBufferRange(target, offset, length, access); }
+#define glMapBufferRange trace_glMapBufferRange
+inline void trace_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) { gl_trace::Scope scope(gl_trace::FlushMappedBufferRange, gl_trace::Upload); glFlushMappedBufferRange(target, offset, length); }
+#define glFlushMappedBufferRange trace_glFlushMappedBufferRange
+inline void trace_glBindVertexArray(GLuint array) { gl_trace::Scope scope(gl_trace::BindVertexArray, gl_trace::Bind); glBindVertexArray(array); }
+#define glBindVertexArray trace_glBindVertexArray
+inline void trace_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) { gl_trace::Scope scope(gl_trace::DeleteVertexArrays, gl_trace::Other); glDeleteVertexArrays(n, arrays); }
+#define glDeleteVertexArrays trace_glDeleteVertexArrays
+inline void trace_glGenVertexArrays(GLsizei n, GLuint *arrays) { gl_trace::Scope scope(gl_trace::GenVertexArrays, gl_trace::Other); glGenVertexArrays(n, arrays); }
+#define glGenVertexArrays trace_glGenVertexArrays
+inline GLboolean trace_glIsVertexArray(GLuint array) { gl_trace::Scope scope(gl_trace::IsVertexArray, gl_trace::Other); return glIsVertexArray(array); }
+#define glIsVertexArray trace_glIsVertexArray
+inline void trace_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) { gl_trace::Scope scope(gl_trace::DrawArraysInstanced, gl_trace::Draw); glDrawArraysInstanced(mode, first, count, instancecount); }
+#define glDrawArraysInstanced trace_glDrawArraysInstanced
+inline void trace_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) { gl_trace::Scope scope(gl_trace::DrawElementsInstanced, gl_trace::Draw); glDrawElementsInstanced(mode, count, type, indices, instancecount); }
+#define glDrawElementsInstanced trace_glDrawElementsInstanced
+inline void trace_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) { gl_trace::Scope scope(gl_trace::TexBuffer, gl_trace::Other); glTexBuffer(target, internalformat, buffer); }
+#define glTexBuffer trace_glTexBuffer
+inline void trace_glPrimitiveRestartIndex(GLuint index) { gl_trace::Scope scope(gl_trace::PrimitiveRestartIndex, gl_trace::State); glPrimitiveRestartIndex(index); }
+#define glPrimitiveRestartIndex trace_glPrimitiveRestartIndex
+inline void trace_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) { gl_trace::Scope scope(gl_trace::CopyBufferSubData, gl_trace::Upload); glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size); }
+#define glCopyBufferSubData trace_glCopyBufferSubData
+inline void trace_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) { gl_trace::Scope scope(gl_trace::GetUniformIndices, gl_trace::Other); glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices); }
+#define glGetUniformIndices trace_glGetUniformIndices
+inline void trace_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) { gl_trace::Scope scope(gl_trace::GetActiveUniformsiv, gl_trace::Other); glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params); }
+#define glGetActiveUniformsiv trace_glGetActiveUniformsiv
+inline void trace_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) { gl_trace::Scope scope(gl_trace::GetActiveUniformName, gl_trace::Other); glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName); }
+#define glGetActiveUniformName trace_glGetActiveUniformName
+inline GLuint trace_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) { gl_trace::Scope scope(gl_trace::GetUniformBlockIndex, gl_trace::Other); return glGetUniformBlockIndex(program, uniformBlockName); }
+#define glGetUniformBlockIndex trace_glGetUniformBlockIndex
+inline void trace_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) { gl_trace::Scope scope(gl_trace::GetActiveUniformBlockiv, gl_trace::Other); glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params); }
+#define glGetActiveUniformBlockiv trace_glGetActiveUniformBlockiv
+inline void trace_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) { gl_trace::Scope scope(gl_trace::GetActiveUniformBlockName, gl_trace::Other); glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName); }
+#define glGetActiveUniformBlockName trace_glGetActiveUniformBlockName
+inline void trace_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) { gl_trace::Scope scope(gl_trace::UniformBlockBinding, gl_trace::State); glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding); }
+#define glUniformBlockBinding trace_glUniformBlockBinding
+inline void trace_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) { gl_trace::Scope scope(gl_trace::DrawElementsBaseVertex, gl_trace::Draw); glDrawElementsBaseVertex(mode, count, type, indices, basevertex); }
+#define glDrawElementsBaseVertex trace_glDrawElementsBaseVertex
+inline void trace_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) { gl_trace::Scope scope(gl_trace::DrawRangeElementsBaseVertex, gl_trace::Draw); glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex); }
+#define glDrawRangeElementsBaseVertex trace_glDrawRangeElementsBaseVertex
+inline void trace_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) { gl_trace::Scope scope(gl_trace::DrawElementsInstancedBaseVertex, gl_trace::Draw); glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex); }
+#define glDrawElementsInstancedBaseVertex trace_glDrawElementsInstancedBaseVertex
+inline void trace_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) { gl_trace::Scope scope(gl_trace::MultiDrawElementsBaseVertex, gl_trace::Draw); glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex); }
+#define glMultiDrawElementsBaseVertex trace_glMultiDrawElementsBaseVertex
+inline void trace_glProvokingVertex(GLenum mode) { gl_trace::Scope scope(gl_trace::ProvokingVertex, gl_trace::State); glProvokingVertex(mode); }
+#define glProvokingVertex trace_glProvokingVertex
+inline GLsync trace_glFenceSync(GLenum condition, GLbitfield flags) { gl_trace::Scope scope(gl_trace::FenceSync, gl_trace::Other); return glFenceSync(condition, flags); }
+#define glFenceSync trace_glFenceSync
+inline GLboolean trace_glIsSync(GLsync sync) { gl_trace::Scope scope(gl_trace::IsSync, gl_trace::Other); return glIsSync(sync); }
+#define glIsSync trace_glIsSync
+inline void trace_glDeleteSync(GLsync sync) { gl_trace::Scope scope(gl_trace::DeleteSync, gl_trace::Other); glDeleteSync(sync); }
+#define glDeleteSync trace_glDeleteSync
+inline GLenum trace_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) { gl_trace::Scope scope(gl_trace::ClientWaitSync, gl_trace::Other); return glClientWaitSync(sync, flags, timeout); }
+#define glClientWaitSync trace_glClientWaitSync
+inline void trace_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) { gl_trace::Scope scope(gl_trace::WaitSync, gl_trace::Other); glWaitSync(sync, flags, timeout); }
+#define glWaitSync trace_glWaitSync
+inline void trace_glGetInteger64v(GLenum pname, GLint64 *data) { gl_trace::Scope scope(gl_trace::GetInteger64v, gl_trace::Other); glGetInteger64v(pname, data); }
+#define glGetInteger64v trace_glGetInteger64v
+inline void trace_glGetSynciv(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values) { gl_trace::Scope scope(gl_trace::GetSynciv, gl_trace::Other); glGetSynciv(sync, pname, bufSize, length, values); }
+#define glGetSynciv trace_glGetSynciv
+inline void trace_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) { gl_trace::Scope scope(gl_trace::GetInteger64i_v, gl_trace::Other); glGetInteger64i_v(target, index, data); }
+#define glGetInteger64i_v trace_glGetInteger64i_v
+inline void trace_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) { gl_trace::Scope scope(gl_trace::GetBufferParameteri64v, gl_trace::Other); glGetBufferParameteri64v(target, pname, params); }
+#define glGetBufferParameteri64v trace_glGetBufferParameteri64v
+inline void trace_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) { gl_trace::Scope scope(gl_trace::FramebufferTexture, gl_trace::Other); glFramebufferTexture(target, attachment, texture, level); }
+#define glFramebufferTexture trace_glFramebufferTexture
+inline void trace_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) { gl_trace::Scope scope(gl_trace::TexImage2DMultisample, gl_trace::Upload); glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations); }
+#define glTexImage2DMultisample trace_glTexImage2DMultisample
+inline void trace_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) { gl_trace::Scope scope(gl_trace::TexImage3DMultisample, gl_trace::Upload); glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations); }
+#define glTexImage3DMultisample trace_glTexImage3DMultisample
+inline void trace_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) { gl_trace::Scope scope(gl_trace::GetMultisamplefv, gl_trace::Other); glGetMultisamplefv(pname, index, val); }
+#define glGetMultisamplefv trace_glGetMultisamplefv
+inline void trace_glSampleMaski(GLuint maskNumber, GLbitfield mask) { gl_trace::Scope scope(gl_trace::SampleMaski, gl_trace::State); glSampleMaski(maskNumber, mask); }
+#define glSampleMaski trace_glSampleMaski
+inline void trace_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) { gl_trace::Scope scope(gl_trace::BindFragDataLocationIndexed, gl_trace::Bind); glBindFragDataLocationIndexed(program, colorNumber, index, name); }
+#define glBindFragDataLocationIndexed trace_glBindFragDataLocationIndexed
+inline GLint trace_glGetFragDataIndex(GLuint program, const GLchar *name) { gl_trace::Scope scope(gl_trace::GetFragDataIndex, gl_trace::Other); return glGetFragDataIndex(program, name); }
+#define glGetFragDataIndex trace_glGetFragDataIndex
+inline void trace_glGenSamplers(GLsizei count, GLuint *samplers) { gl_trace::Scope scope(gl_trace::GenSamplers, gl_trace::Other); glGenSamplers(count, samplers); }
+#define glGenSamplers trace_glGenSamplers
+inline void trace_glDeleteSamplers(GLsizei count, const GLuint *samplers) { gl_trace::Scope scope(gl_trace::DeleteSamplers, gl_trace::Other); glDeleteSamplers(count, samplers); }
+#define glDeleteSamplers trace_glDeleteSamplers
+inline GLboolean trace_glIsSampler(GLuint sampler) { gl_trace::Scope scope(gl_trace::IsSampler, gl_trace::Other); return glIsSampler(sampler); }
+#define glIsSampler trace_glIsSampler
+inline void trace_glBindSampler(GLuint unit, GLuint sampler) { gl_trace::Scope scope(gl_trace::BindSampler, gl_trace::Bind); glBindSampler(unit, sampler); }
+#define glBindSampler trace_glBindSampler
+inline void trace_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) { gl_trace::Scope scope(gl_trace::SamplerParameteri, gl_trace::State); glSamplerParameteri(sampler, pname, param); }
+#define glSamplerParameteri trace_glSamplerParameteri
+inline void trace_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) { gl_trace::Scope scope(gl_trace::SamplerParameteriv, gl_trace::State); glSamplerParameteriv(sampler, pname, param); }
+#define glSamplerParameteriv trace_glSamplerParameteriv
+inline void trace_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) { gl_trace::Scope scope(gl_trace::SamplerParameterf, gl_trace::State); glSamplerParameterf(sampler, pname, param); }
+#define glSamplerParameterf trace_glSamplerParameterf
+inline void trace_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) { gl_trace::Scope scope(gl_trace::SamplerParameterfv, gl_trace::State); glSamplerParameterfv(sampler, pname, param); }
+#define glSamplerParameterfv trace_glSamplerParameterfv
+inline void trace_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) { gl_trace::Scope scope(gl_trace::SamplerParameterIiv, gl_trace::State); glSamplerParameterIiv(sampler, pname, param); }
+#define glSamplerParameterIiv trace_glSamplerParameterIiv
+inline void trace_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) { gl_trace::Scope scope(gl_trace::SamplerParameterIuiv, gl_trace::State); glSamplerParameterIuiv(sampler, pname, param); }
+#define glSamplerParameterIuiv trace_glSamplerParameterIuiv
+inline void trace_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) { gl_trace::Scope scope(gl_trace::GetSamplerParameteriv, gl_trace::Other); glGetSamplerParameteriv(sampler, pname, params); }
+#define glGetSamplerParameteriv trace_glGetSamplerParameteriv
+inline void trace_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) { gl_trace::Scope scope(gl_trace::GetSamplerParameterIiv, gl_trace::Other); glGetSamplerParameterIiv(sampler, pname, params); }
+#define glGetSamplerParameterIiv trace_glGetSamplerParameterIiv
+inline void trace_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) { gl_trace::Scope scope(gl_trace::GetSamplerParameterfv, gl_trace::Other); glGetSamplerParameterfv(sampler, pname, params); }
+#define glGetSamplerParameterfv trace_glGetSamplerParameterfv
+inline void trace_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) { gl_trace::Scope scope(gl_trace::GetSamplerParameterIuiv, gl_trace::Other); glGetSamplerParameterIuiv(sampler, pname, params); }
+#define glGetSamplerParameterIuiv trace_glGetSamplerParameterIuiv
+inline void trace_glQueryCounter(GLuint id, GLenum target) { gl_trace::Scope scope(gl_trace::QueryCounter, gl_trace::Other); glQueryCounter(id, target); }
+#define glQueryCounter trace_glQueryCounter
+inline void trace_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) { gl_trace::Scope scope(gl_trace::GetQueryObjecti64v, gl_trace::Other); glGetQueryObjecti64v(id, pname, params); }
+#define glGetQueryObjecti64v trace_glGetQueryObjecti64v
+inline void trace_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) { gl_trace::Scope scope(gl_trace::GetQueryObjectui64v, gl_trace::Other); glGetQueryObjectui64v(id, pname, params); }
+#define glGetQueryObjectui64v trace_glGetQueryObjectui64v
+inline void trace_glVertexAttribDivisor(GLuint index, GLuint divisor) { gl_trace::Scope scope(gl_trace::VertexAttribDivisor, gl_trace::State); glVertexAttribDivisor(index, divisor); }
+#define glVertexAttribDivisor trace_glVertexAttribDivisor
+inline void trace_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) { gl_trace::Scope scope(gl_trace::VertexAttribP1ui, gl_trace::Other); glVertexAttribP1ui(index, type, normalized, value); }
+#define glVertexAttribP1ui trace_glVertexAttribP1ui
+inline void trace_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { gl_trace::Scope scope(gl_trace::VertexAttribP1uiv, gl_trace::Other); glVertexAttribP1uiv(index, type, normalized, value); }
+#define glVertexAttribP1uiv trace_glVertexAttribP1uiv
+inline void trace_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) { gl_trace::Scope scope(gl_trace::VertexAttribP2ui, gl_trace::Other); glVertexAttribP2ui(index, type, normalized, value); }
+#define glVertexAttribP2ui trace_glVertexAttribP2ui
+inline void trace_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { gl_trace::Scope scope(gl_trace::VertexAttribP2uiv, gl_trace::Other); glVertexAttribP2uiv(index, type, normalized, value); }
+#define glVertexAttribP2uiv trace_glVertexAttribP2uiv
+inline void trace_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) { gl_trace::Scope scope(gl_trace::VertexAttribP3ui, gl_trace::Other); glVertexAttribP3ui(index, type, normalized, value); }
+#define glVertexAttribP3ui trace_glVertexAttribP3ui
+inline void trace_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { gl_trace::Scope scope(gl_trace::VertexAttribP3uiv, gl_trace::Other); glVertexAttribP3uiv(index, type, normalized, value); }
+#define glVertexAttribP3uiv trace_glVertexAttribP3uiv
+inline void trace_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) { gl_trace::Scope scope(gl_trace::VertexAttribP4ui, gl_trace::Other); glVertexAttribP4ui(index, type, normalized, value); }
+#define glVertexAttribP4ui trace_glVertexAttribP4ui
+inline void trace_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { gl_trace::Scope scope(gl_trace::VertexAttribP4uiv, gl_trace::Other); glVertexAttribP4uiv(index, type, normalized, value); }
+#define glVertexAttribP4uiv trace_glVertexAttribP4uiv
+
+#ifdef GL_TRACE_NAMES
+//(for gl_trace.cpp)
+static char const *const gl_trace_function_names[] = {
+	"glCullFace",
+	"glFrontFace",
+	"glHint",
+	"glLineWidth",
+	"glPointSize",
+	"glPolygonMode",
+	"glScissor",
+	"glTexParameterf",
+	"glTexParameterfv",
+	"glTexParameteri",
+	"glTexParameteriv",
+	"glTexImage1D",
+	"glTexImage2D",
+	"glDrawBuffer",
+	"glClear",
+	"glClearColor",
+	"glClearStencil",
+	"glClearDepth",
+	"glStencilMask",
+	"glColorMask",
+	"glDepthMask",
+	"glDisable",
+	"glEnable",
+	"glFinish",
+	"glFlush",
+	"glBlendFunc",
+	"glLogicOp",
+	"glStencilFunc",
+	"glStencilOp",
+	"glDepthFunc",
+	"glPixelStoref",
+	"glPixelStorei",
+	"glReadBuffer",
+	"glReadPixels",
+	"glGetBooleanv",
+	"glGetDoublev",
+	"glGetError",
+	"glGetFloatv",
+	"glGetIntegerv",
+	"glGetString",
+	"glGetTexImage",
+	"glGetTexParameterfv",
+	"glGetTexParameteriv",
+	"glGetTexLevelParameterfv",
+	"glGetTexLevelParameteriv",
+	"glIsEnabled",
+	"glDepthRange",
+	"glViewport",
+	"glDrawArrays",
+	"glDrawElements",
+	"glGetPointerv",
+	"glPolygonOffset",
+	"glCopyTexImage1D",
+	"glCopyTexImage2D",
+	"glCopyTexSubImage1D",
+	"glCopyTexSubImage2D",
+	"glTexSubImage1D",
+	"glTexSubImage2D",
+	"glBindTexture",
+	"glDeleteTextures",
+	"glGenTextures",
+	"glIsTexture",
+	"glDrawRangeElements",
+	"glTexImage3D",
+	"glTexSubImage3D",
+	"glCopyTexSubImage3D",
+	"glActiveTexture",
+	"glSampleCoverage",
+	"glCompressedTexImage3D",
+	"glCompressedTexImage2D",
+	"glCompressedTexImage1D",
+	"glCompressedTexSubImage3D",
+	"glCompressedTexSubImage2D",
+	"glCompressedTexSubImage1D",
+	"glGetCompressedTexImage",
+	"glBlendFuncSeparate",
+	"glMultiDrawArrays",
+	"glMultiDrawElements",
+	"glPointParameterf",
+	"glPointParameterfv",
+	"glPointParameteri",
+	"glPointParameteriv",
+	"glBlendColor",
+	"glBlendEquation",
+	"glGenQueries",
+	"glDeleteQueries",
+	"glIsQuery",
+	"glBeginQuery",
+	"glEndQuery",
+	"glGetQueryiv",
+	"glGetQueryObjectiv",
+	"glGetQueryObjectuiv",
+	"glBindBuffer",
+	"glDeleteBuffers",
+	"glGenBuffers",
+	"glIsBuffer",
+	"glBufferData",
+	"glBufferSubData",
+	"glGetBufferSubData",
+	"glMapBuffer",
+	"glUnmapBuffer",
+	"glGetBufferParameteriv",
+	"glGetBufferPointerv",
+	"glBlendEquationSeparate",
+	"glDrawBuffers",
+	"glStencilOpSeparate",
+	"glStencilFuncSeparate",
+	"glStencilMaskSeparate",
+	"glAttachShader",
+	"glBindAttribLocation",
+	"glCompileShader",
+	"glCreateProgram",
+	"glCreateShader",
+	"glDeleteProgram",
+	"glDeleteShader",
+	"glDetachShader",
+	"glDisableVertexAttribArray",
+	"glEnableVertexAttribArray",
+	"glGetActiveAttrib",
+	"glGetActiveUniform",
+	"glGetAttachedShaders",
+	"glGetAttribLocation",
+	"glGetProgramiv",
+	"glGetProgramInfoLog",
+	"glGetShaderiv",
+	"glGetShaderInfoLog",
+	"glGetShaderSource",
+	"glGetUniformLocation",
+	"glGetUniformfv",
+	"glGetUniformiv",
+	"glGetVertexAttribdv",
+	"glGetVertexAttribfv",
+	"glGetVertexAttribiv",
+	"glGetVertexAttribPointerv",
+	"glIsProgram",
+	"glIsShader",
+	"glLinkProgram",
+	"glShaderSource",
+	"glUseProgram",
+	"glUniform1f",
+	"glUniform2f",
+	"glUniform3f",
+	"glUniform4f",
+	"glUniform1i",
+	"glUniform2i",
+	"glUniform3i",
+	"glUniform4i",
+	"glUniform1fv",
+	"glUniform2fv",
+	"glUniform3fv",
+	"glUniform4fv",
+	"glUniform1iv",
+	"glUniform2iv",
+	"glUniform3iv",
+	"glUniform4iv",
+	"glUniformMatrix2fv",
+	"glUniformMatrix3fv",
+	"glUniformMatrix4fv",
+	"glValidateProgram",
+	"glVertexAttrib1d",
+	"glVertexAttrib1dv",
+	"glVertexAttrib1f",
+	"glVertexAttrib1fv",
+	"glVertexAttrib1s",
+	"glVertexAttrib1sv",
+	"glVertexAttrib2d",
+	"glVertexAttrib2dv",
+	"glVertexAttrib2f",
+	"glVertexAttrib2fv",
+	"glVertexAttrib2s",
+	"glVertexAttrib2sv",
+	"glVertexAttrib3d",
+	"glVertexAttrib3dv",
+	"glVertexAttrib3f",
+	"glVertexAttrib3fv",
+	"glVertexAttrib3s",
+	"glVertexAttrib3sv",
+	"glVertexAttrib4Nbv",
+	"glVertexAttrib4Niv",
+	"glVertexAttrib4Nsv",
+	"glVertexAttrib4Nub",
+	"glVertexAttrib4Nubv",
+	"glVertexAttrib4Nuiv",
+	"glVertexAttrib4Nusv",
+	"glVertexAttrib4bv",
+	"glVertexAttrib4d",
+	"glVertexAttrib4dv",
+	"glVertexAttrib4f",
+	"glVertexAttrib4fv",
+	"glVertexAttrib4iv",
+	"glVertexAttrib4s",
+	"glVertexAttrib4sv",
+	"glVertexAttrib4ubv",
+	"glVertexAttrib4uiv",
+	"glVertexAttrib4usv",
+	"glVertexAttribPointer",
+	"glUniformMatrix2x3fv",
+	"glUniformMatrix3x2fv",
+	"glUniformMatrix2x4fv",
+	"glUniformMatrix4x2fv",
+	"glUniformMatrix3x4fv",
+	"glUniformMatrix4x3fv",
+	"glColorMaski",
+	"glGetBooleani_v",
+	"glGetIntegeri_v",
+	"glEnablei",
+	"glDisablei",
+	"glIsEnabledi",
+	"glBeginTransformFeedback",
+	"glEndTransformFeedback",
+	"glBindBufferRange",
+	"glBindBufferBase",
+	"glTransformFeedbackVaryings",
+	"glGetTransformFeedbackVarying",
+	"glClampColor",
+	"glBeginConditionalRender",
+	"glEndConditionalRender",
+	"glVertexAttribIPointer",
+	"glGetVertexAttribIiv",
+	"glGetVertexAttribIuiv",
+	"glVertexAttribI1i",
+	"glVertexAttribI2i",
+	"glVertexAttribI3i",
+	"glVertexAttribI4i",
+	"glVertexAttribI1ui",
+	"glVertexAttribI2ui",
+	"glVertexAttribI3ui",
+	"glVertexAttribI4ui",
+	"glVertexAttribI1iv",
+	"glVertexAttribI2iv",
+	"glVertexAttribI3iv",
+	"glVertexAttribI4iv",
+	"glVertexAttribI1uiv",
+	"glVertexAttribI2uiv",
+	"glVertexAttribI3uiv",
+	"glVertexAttribI4uiv",
+	"glVertexAttribI4bv",
+	"glVertexAttribI4sv",
+	"glVertexAttribI4ubv",
+	"glVertexAttribI4usv",
+	"glGetUniformuiv",
+	"glBindFragDataLocation",
+	"glGetFragDataLocation",
+	"glUniform1ui",
+	"glUniform2ui",
+	"glUniform3ui",
+	"glUniform4ui",
+	"glUniform1uiv",
+	"glUniform2uiv",
+	"glUniform3uiv",
+	"glUniform4uiv",
+	"glTexParameterIiv",
+	"glTexParameterIuiv",
+	"glGetTexParameterIiv",
+	"glGetTexParameterIuiv",
+	"glClearBufferiv",
+	"glClearBufferuiv",
+	"glClearBufferfv",
+	"glClearBufferfi",
+	"glGetStringi",
+	"glIsRenderbuffer",
+	"glBindRenderbuffer",
+	"glDeleteRenderbuffers",
+	"glGenRenderbuffers",
+	"glRenderbufferStorage",
+	"glGetRenderbufferParameteriv",
+	"glIsFramebuffer",
+	"glBindFramebuffer",
+	"glDeleteFramebuffers",
+	"glGenFramebuffers",
+	"glCheckFramebufferStatus",
+	"glFramebufferTexture1D",
+	"glFramebufferTexture2D",
+	"glFramebufferTexture3D",
+	"glFramebufferRenderbuffer",
+	"glGetFramebufferAttachmentParameteriv",
+	"glGenerateMipmap",
+	"glBlitFramebuffer",
+	"glRenderbufferStorageMultisample",
+	"glFramebufferTextureLayer",
+	"glMapBufferRange",
+	"glFlushMappedBufferRange",
+	"glBindVertexArray",
+	"glDeleteVertexArrays",
+	"glGenVertexArrays",
+	"glIsVertexArray",
+	"glDrawArraysInstanced",
+	"glDrawElementsInstanced",
+	"glTexBuffer",
+	"glPrimitiveRestartIndex",
+	"glCopyBufferSubData",
+	"glGetUniformIndices",
+	"glGetActiveUniformsiv",
+	"glGetActiveUniformName",
+	"glGetUniformBlockIndex",
+	"glGetActiveUniformBlockiv",
+	"glGetActiveUniformBlockName",
+	"glUniformBlockBinding",
+	"glDrawElementsBaseVertex",
+	"glDrawRangeElementsBaseVertex",
+	"glDrawElementsInstancedBaseVertex",
+	"glMultiDrawElementsBaseVertex",
+	"glProvokingVertex",
+	"glFenceSync",
+	"glIsSync",
+	"glDeleteSync",
+	"glClientWaitSync",
+	"glWaitSync",
+	"glGetInteger64v",
+	"glGetSynciv",
+	"glGetInteger64i_v",
+	"glGetBufferParameteri64v",
+	"glFramebufferTexture",
+	"glTexImage2DMultisample",
+	"glTexImage3DMultisample",
+	"glGetMultisamplefv",
+	"glSampleMaski",
+	"glBindFragDataLocationIndexed",
+	"glGetFragDataIndex",
+	"glGenSamplers",
+	"glDeleteSamplers",
+	"glIsSampler",
+	"glBindSampler",
+	"glSamplerParameteri",
+	"glSamplerParameteriv",
+	"glSamplerParameterf",
+	"glSamplerParameterfv",
+	"glSamplerParameterIiv",
+	"glSamplerParameterIuiv",
+	"glGetSamplerParameteriv",
+	"glGetSamplerParameterIiv",
+	"glGetSamplerParameterfv",
+	"glGetSamplerParameterIuiv",
+	"glQueryCounter",
+	"glGetQueryObjecti64v",
+	"glGetQueryObjectui64v",
+	"glVertexAttribDivisor",
+	"glVertexAttribP1ui",
+	"glVertexAttribP1uiv",
+	"glVertexAttribP2ui",
+	"glVertexAttribP2uiv",
+	"glVertexAttribP3ui",
+	"glVertexAttribP3uiv",
+	"glVertexAttribP4ui",
+	"glVertexAttribP4uiv",
+};
+#endif //GL_TRACE_NAMES
+
+#endif //GL_TRACE_HPP
@@ -0,0 +1,87 @@
+#include "gpu_timer.hpp"
+
+#include <cassert>
+
+GpuTimer::GpuTimer(unsigned int passes) : pass_ms(passes, -1.0f) {
+	for (auto &set : sets) {
+		set.passes.resize(passes, 0);
+		set.issued.resize(passes, false);
+		glGenQueries(GLsizei(passes), &set.passes[0]);
+		glGenQueries(1, &set.frame_begin);
+		glGenQueries(1, &set.frame_end);
+	}
+}
+
+GpuTimer::~GpuTimer() {
+	for (auto &set : sets) {
+		glDeleteQueries(GLsizei(set.passes.size()), &set.passes[0]);
+		glDeleteQueries(1, &set.frame_begin);
+		glDeleteQueries(1, &set.frame_end);
+	}
+}
+
+void GpuTimer::begin_frame() {
+	assert(active == -1);
+	Set &set = sets[current];
+	ready = false;
+	if (set.pending) {
+		set.pending = false;
+		//check without waiting; the frame's end timestamp is its last query, but check them all anyway:
+		auto available = [](GLuint query) {
+			GLuint result = GL_FALSE;
+			glGetQueryObjectuiv(query, GL_QUERY_RESULT_AVAILABLE, &result);
+			return result == GL_TRUE;
+		};
+		bool done = available(set.frame_begin) && available(set.frame_end);
+		for (unsigned int p = 0; p < set.passes.size(); ++p) {
+			if (set.issued[p] && !available(set.passes[p])) done = false;
+		}
+		if (done) {
+			GLuint64 elapsed = 0;
+			for (unsigned int p = 0; p < set.passes.size(); ++p) {
+				if (set.issued[p]) {
+					glGetQueryObjectui64v(set.passes[p], GL_QUERY_RESULT, &elapsed);
+					pass_ms[p] = float(elapsed) * 1e-6f;
+				} else {
+					pass_ms[p] = -1.0f;
+				}
+			}
+			GLuint64 begin = 0, end = 0;
+			glGetQueryObjectui64v(set.frame_begin, GL_QUERY_RESULT, &begin);
+			glGetQueryObjectui64v(set.frame_end, GL_QUERY_RESULT, &end);
+			frame_ms = float(end - begin) * 1e-6f;
+			ready = true;
+		} else {
+			//(reissuing the queries below discards the old results)
+			++missed;
+		}
+	}
+
+	for (unsigned int p = 0; p < set.issued.size(); ++p) {
+		set.issued[p] = false;
+	}
+	glQueryCounter(set.frame_begin, GL_TIMESTAMP);
+}
+
+void GpuTimer::begin(unsigned int pass) {
+	Set &set = sets[current];
+	assert(active == -1 && "GpuTimer passes can't nest");
+	assert(pass < set.passes.size() && !set.issued[pass]);
+	glBeginQuery(GL_TIME_ELAPSED, set.passes[pass]);
+	set.issued[pass] = true;
+	active = int(pass);
+}
+
+void GpuTimer::end() {
+	assert(active != -1);
+	glEndQuery(GL_TIME_ELAPSED);
+	active = -1;
+}
+
+void GpuTimer::end_frame() {
+	assert(active == -1);
+	Set &set = sets[current];
+	glQueryCounter(set.frame_end, GL_TIMESTAMP);
+	set.pending = true;
+	current = (current + 1) % Frames;
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "GL.hpp"
+
+#include <vector>
+
+/*
+ * GPU timing of the draw passes in a frame, using timer queries.
+ *
+ * Each pass is bracketed by a GL_TIME_ELAPSED query; the whole frame by a
+ * pair of GL_TIMESTAMP queries (elapsed-time queries can't nest). Queries
+ * are double-buffered: a frame's results are collected two frames later,
+ * when the same queries are about to be reused, and only if the GPU has
+ * already finished them -- so timing never stalls the pipeline. (If they're
+ * still pending, that frame's results are dropped.)
+ *
+ * Usage (once per drawn frame):
+ *   timer.begin_frame(); //also collects results from two frames ago
+ *   if (timer.ready) ... timer.pass_ms[p], timer.frame_ms ...
+ *   timer.begin(0); ... draw pass 0 ... timer.end();
+ *   ...
+ *   timer.end_frame();
+ */
+
+struct GpuTimer {
+	//time 'passes' passes per frame:
+	GpuTimer(unsigned int passes);
+	~GpuTimer();
+	GpuTimer(GpuTimer const &) = delete;
+	GpuTimer &operator=(GpuTimer const &) = delete;
+
+	//start a frame (collecting the previous results from this frame's queries):
+	void begin_frame();
+	//time the commands issued between begin(pass) and end() (at most once per pass per frame):
+	void begin(unsigned int pass);
+	void end();
+	//finish the frame:
+	void end_frame();
+
+	static const unsigned int Frames = 2; //query sets in flight
+
+	//most recent results, set by begin_frame():
+	bool ready = false; //have results (otherwise the oldest frame wasn't finished, or nothing has been timed yet)
+	std::vector< float > pass_ms; //time spent in each pass (or -1 if it wasn't run that frame)
+	float frame_ms = 0.0f; //time from the start of the frame's first command to the end of its last
+	// (includes any time the GPU spent waiting on the CPU in between)
+	unsigned int missed = 0; //frames whose results weren't ready in time
+
+private:
+	struct Set {
+		std::vector< GLuint > passes; //TIME_ELAPSED
+		std::vector< bool > issued; //passes actually begun this frame
+		GLuint frame_begin = 0; //TIMESTAMP
+		GLuint frame_end = 0; //TIMESTAMP
+		bool pending = false; //queries issued, results not yet collected
+	};
+	Set sets[Frames];
+	unsigned int current = 0;
+	int active = -1; //pass with an open query
+};
@@ -0,0 +1,81 @@
+#include "headless.hpp"
+#include "batch.hpp"
+#include "maze.hpp"
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <vector>
+
+int run_headless(HeadlessConfig const &config) {
+	if (config.agents) return run_batch(config);
+
+	Maze maze = (config.width && config.height ? Maze::generate(config.width, config.height, config.seed) : Maze::cave());
+
+	//scripted input, if any:
+	std::vector< Direction > script;
+	if (!config.script.empty()) {
+		std::ifstream file(config.script.c_str());
+		if (!file) {
+			std::cerr << "Failed to open move script '" << config.script << "'." << std::endl;
+			return 1;
+		}
+		char c;
+		while (file.get(c)) {
+			if (c == 'U' || c == 'u') script.emplace_back(Up);
+			else if (c == 'L' || c == 'l') script.emplace_back(Left);
+			else if (c == 'D' || c == 'd') script.emplace_back(Down);
+			else if (c == 'R' || c == 'r') script.emplace_back(Right);
+		}
+	}
+	uint64_t moves = config.moves;
+	if (!config.script.empty() && script.size() < moves) moves = script.size();
+
+	std::mt19937_64 mt(config.seed);
+	uint64_t random_bits = 0;
+	uint32_t random_left = 0;
+
+	uint32_t at = maze.start;
+	uint64_t taken = 0;
+	uint64_t mines_hit = 0;
+	uint64_t treasure_step = 0; //moves taken when the treasure was first reached (0 = never)
+
+	auto before = std::chrono::high_resolution_clock::now();
+	for (uint64_t m = 0; m < moves; ++m) {
+		Direction dir;
+		if (!script.empty()) {
+			dir = script[m];
+		} else {
+			//two random bits per move:
+			if (random_left == 0) {
+				random_bits = mt();
+				random_left = 32;
+			}
+			dir = Direction(random_bits & 3);
+			random_bits >>= 2;
+			--random_left;
+		}
+		if (!maze.move(&at, dir)) continue;
+		++taken;
+		if (maze.mines.get(at)) ++mines_hit;
+		if (treasure_step == 0 && maze.treasure.get(at)) treasure_step = taken;
+	}
+	auto after = std::chrono::high_resolution_clock::now();
+	double seconds = std::chrono::duration< double >(after - before).count();
+
+	uint32_t tiles = maze.width * maze.height;
+	uint32_t visited = maze.visited.count();
+	std::cout << "Maze: " << maze.width << "x" << maze.height << " (" << (config.width && config.height ? "random" : "cave") << ")\n";
+	std::cout << "Moves attempted: " << moves << " (" << (script.empty() ? "random" : "scripted") << ")\n";
+	std::cout << "Moves taken: " << taken << "\n";
+	std::cout << "Mines hit: " << mines_hit << "\n";
+	if (treasure_step) {
+		std::cout << "Treasure found after " << treasure_step << " moves taken\n";
+	} else {
+		std::cout << "Treasure not found.\n";
+	}
+	std::cout << "Tiles visited: " << visited << " / " << tiles << " (" << (100.0 * visited / tiles) << "%)\n";
+	std::cout << "Time: " << seconds << "s (" << (seconds > 0.0 ? moves / seconds : 0.0) << " moves/s)" << std::endl;
+	return 0;
+}
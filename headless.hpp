@@ -0,0 +1,23 @@
+#pragma once
+
+#include <string>
+#include <stdint.h>
+
+/*
+ * Headless simulation: plays the maze movement rules with no window, GL
+ * context, or textures, driven by a scripted or random stream of moves,
+ * and reports what happened (and how fast).
+ */
+
+struct HeadlessConfig {
+	uint64_t moves = 1000000; //moves to attempt (random input) or upper limit (scripted input)
+	uint64_t seed = 0; //seed for random input and random mazes
+	std::string script; //if not empty, read moves (U/L/D/R, case-insensitive) from this file instead of randomly (single agent only)
+	uint32_t width = 0; //if nonzero, play on a random width x height maze instead of the cave
+	uint32_t height = 0;
+	uint32_t agents = 0; //if nonzero, run this many independent agents in parallel instead (see batch.hpp)
+	uint32_t threads = 0; //worker threads for batch runs (0 = one per hardware thread)
+};
+
+//run the simulation and print a report to std::cout; returns a process exit code:
+int run_headless(HeadlessConfig const &config);
@@ -1,10 +1,13 @@
 #include "load_save_png.hpp"
+#include "mapped_file.hpp"
 
 #include <png.h>
 
 #include <iostream>
 #include <fstream>
 #include <cassert>
+#include <cstring>
+#include <functional>
 #include <vector>
 
 #define LOG_ERROR( X ) std::cerr << X << std::endl
@@ -12,12 +15,13 @@
 using std::vector;
 
 bool load_png(std::string filename, unsigned int *width, unsigned int *height, std::vector< uint32_t > *data, OriginLocation origin) {
-	std::ifstream file(filename.c_str(), std::ios::binary);
-	if (!file) {
+	//map the file and let libpng read straight from the mapping:
+	MappedFile file(filename);
+	if (!file.is_open()) {
 		LOG_ERROR("  cannot open file.");
 		return false;
 	}
-	return load_png(file, width, height, data, origin);
+	return load_png(file.data, file.size, width, height, data, origin);
 }
 
 void save_png(std::string filename, unsigned int width, unsigned int height, uint32_t const *data, OriginLocation origin) {
@@ -34,6 +38,22 @@ static void user_read_data(png_structp png_ptr, png_bytep data, png_size_t lengt
 	}
 }
 
+struct MemoryReader {
+	uint8_t const *at;
+	size_t remaining;
+};
+
+static void user_read_memory(png_structp png_ptr, png_bytep data, png_size_t length) {
+	MemoryReader *from = reinterpret_cast< MemoryReader * >(png_get_io_ptr(png_ptr));
+	assert(from);
+	if (length > from->remaining) {
+		png_error(png_ptr, "Error reading (unexpected end of data).");
+	}
+	std::memcpy(data, from->at, length);
+	from->at += length;
+	from->remaining -= length;
+}
+
 static void user_write_data(png_structp png_ptr, png_bytep data, png_size_t length) {
 	std::ostream *to = reinterpret_cast< std::ostream * >(png_get_io_ptr(png_ptr));
 	assert(to);
@@ -51,18 +71,75 @@ static void user_flush_data(png_structp png_ptr) {
 }
 
 
-bool load_png(std::istream &from, unsigned int *width, unsigned int *height, vector< uint32_t > *data, OriginLocation origin) {
+//Where decoded pixels go: called once the image size is known, returns the first pixel of
+// the (upper-left-origin) top row and sets *stride (in pixels), or returns NULL to stop after
+// reading the header:
+typedef std::function< uint32_t *(unsigned int w, unsigned int h, size_t *stride) > PixelDestination;
+
+static bool read_png(png_voidp io, png_rw_ptr read_fn, unsigned int *width, unsigned int *height, PixelDestination const &destination, OriginLocation origin);
+
+//decode into a (resized) vector:
+static bool read_png(png_voidp io, png_rw_ptr read_fn, unsigned int *width, unsigned int *height, vector< uint32_t > *data, OriginLocation origin) {
 	assert(data);
+	data->clear();
+	bool ok = read_png(io, read_fn, width, height, [data](unsigned int w, unsigned int h, size_t *stride) {
+		data->resize(w*h);
+		*stride = w;
+		return &(*data)[0];
+	}, origin);
+	if (!ok) data->clear();
+	return ok;
+}
+
+bool load_png(std::istream &from, unsigned int *width, unsigned int *height, vector< uint32_t > *data, OriginLocation origin) {
+	return read_png(&from, user_read_data, width, height, data, origin);
+}
+
+bool load_png(uint8_t const *bytes, size_t size, unsigned int *width, unsigned int *height, vector< uint32_t > *data, OriginLocation origin) {
+	MemoryReader from;
+	from.at = bytes;
+	from.remaining = size;
+	return read_png(&from, user_read_memory, width, height, data, origin);
+}
+
+bool load_png_size(uint8_t const *bytes, size_t size, unsigned int *width, unsigned int *height) {
+	MemoryReader from;
+	from.at = bytes;
+	from.remaining = size;
+	return read_png(&from, user_read_memory, width, height, [](unsigned int, unsigned int, size_t *) -> uint32_t * {
+		return NULL;
+	}, UpperLeftOrigin);
+}
+
+bool load_png(uint8_t const *bytes, size_t size, unsigned int width, unsigned int height, uint32_t *pixels, size_t stride, OriginLocation origin) {
+	assert(pixels);
+	assert(stride >= width);
+	MemoryReader from;
+	from.at = bytes;
+	from.remaining = size;
+	bool size_ok = true;
+	bool ok = read_png(&from, user_read_memory, NULL, NULL, [&](unsigned int w, unsigned int h, size_t *stride_) -> uint32_t * {
+		if (w != width || h != height) {
+			LOG_ERROR("  image is " << w << "x" << h << ", expected " << width << "x" << height << ".");
+			size_ok = false;
+			return NULL;
+		}
+		*stride_ = stride;
+		return pixels;
+	}, origin);
+	return ok && size_ok;
+}
+
+static bool read_png(png_voidp io, png_rw_ptr read_fn, unsigned int *width, unsigned int *height, PixelDestination const &destination, OriginLocation origin) {
 	uint32_t local_width, local_height;
 	if (width == nullptr) width = &local_width;
 	if (height == nullptr) height = &local_height;
 	*width = *height = 0;
-	data->clear();
 	//..... load file ......
 	//Load a png file, as per the libpng docs:
 	png_structp png = png_create_read_struct(PNG_LIBPNG_VER_STRING, (png_voidp)NULL, (png_error_ptr)NULL, (png_error_ptr)NULL);
 
-	png_set_read_fn(png, &from, user_read_data);
+	png_set_read_fn(png, io, read_fn);
 
 	if (!png) {
 		LOG_ERROR("  cannot alloc read struct.");
@@ -79,7 +156,6 @@ bool load_png(std::istream &from, unsigned int *width, unsigned int *height, vec
 		LOG_ERROR("  png interal error.");
 		png_destroy_read_struct(&png, &info, (png_infopp)NULL);
 		if (row_pointers != NULL) delete[] row_pointers;
-		data->clear();
 		return false;
 	}
 	//not needed with custom read/write functions: png_init_io(png, NULL);
@@ -103,21 +179,29 @@ bool load_png(std::istream &from, unsigned int *width, unsigned int *height, vec
 	//Make sure it's the format we think it is...
 	assert(rowbytes == w*sizeof(uint32_t));
 
-	data->resize(w*h);
+	*width = w;
+	*height = h;
+
+	size_t stride = w;
+	uint32_t *pixels = destination(w, h, &stride);
+	if (pixels == NULL) {
+		//header only:
+		png_destroy_read_struct(&png, &info, NULL);
+		return true;
+	}
+
 	row_pointers = new png_bytep[h];
 	for (unsigned int r = 0; r < h; ++r) {
 		if (origin == LowerLeftOrigin) {
-			row_pointers[h-1-r] = (png_bytep)(&(*data)[r*w]);
+			row_pointers[h-1-r] = (png_bytep)(pixels + r*stride);
 		} else {
-			row_pointers[r] = (png_bytep)(&(*data)[r*w]);
+			row_pointers[r] = (png_bytep)(pixels + r*stride);
 		}
 	}
 	png_read_image(png, row_pointers);
 	png_destroy_read_struct(&png, &info, NULL);
 	delete[] row_pointers;
 
-	*width = w;
-	*height = h;
 	return true;
 }
 
@@ -2,10 +2,12 @@
 
 #include <string>
 #include <vector>
+#include <stddef.h>
 #include <stdint.h>
 
 /*
  * Load and save PNG files.
+ * (Loading by filename memory-maps the file rather than going through iostreams.)
  */
 
 enum OriginLocation {
@@ -17,4 +19,14 @@ bool load_png(std::string filename, unsigned int *width, unsigned int *height, s
 void save_png(std::string filename, unsigned int width, unsigned int height, uint32_t const *data, OriginLocation origin);
 
 bool load_png(std::istream &from, unsigned int *width, unsigned int *height, std::vector< uint32_t > *data, OriginLocation origin = UpperLeftOrigin);
+
+//Load from PNG data already in memory (e.g., a mapped file or an embedded blob); 'bytes' is only read during the call:
+bool load_png(uint8_t const *bytes, size_t size, unsigned int *width, unsigned int *height, std::vector< uint32_t > *data, OriginLocation origin = UpperLeftOrigin);
+
+//Two-phase loading into caller-owned memory (no per-image vector allocation or zero-fill):
+//read just the dimensions of in-memory PNG data:
+bool load_png_size(uint8_t const *bytes, size_t size, unsigned int *width, unsigned int *height);
+//decode into 'pixels', rows 'stride' pixels apart (stride >= width); fails if the image is not width x height:
+bool load_png(uint8_t const *bytes, size_t size, unsigned int width, unsigned int height, uint32_t *pixels, size_t stride, OriginLocation origin = UpperLeftOrigin);
+
 void save_png(std::ostream &to, unsigned int width, unsigned int height, uint32_t const *data, OriginLocation origin = UpperLeftOrigin);
@@ -1,26 +1,138 @@
 #include "load_save_png.hpp"
+#include "atlas.hpp"
+#include "asset_pack.hpp"
+#include "png_cache.hpp"
+#include "pixel_ops.hpp"
+#include "pixel_upload.hpp"
+#include "frame_capture.hpp"
+#include "frame_profiler.hpp"
+#include "gpu_timer.hpp"
+#include "gl_state.hpp"
+#include "camera_uniforms.hpp"
+#include "vertex_ring.hpp"
+#include "static_mesh.hpp"
+#include "shader.hpp"
+#include "tilemap.hpp"
+#include "maze.hpp"
+#include "headless.hpp"
+#include "thread_pool.hpp"
 #include "GL.hpp"
 
 #include <SDL.h>
 #include <glm/glm.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
+#include <algorithm>
+#include <cassert>
 #include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <future>
 #include <iostream>
+#include <memory>
 #include <stdexcept>
 
-static GLuint compile_shader(GLenum type, std::string const &source);
-static GLuint link_program(GLuint vertex_shader, GLuint fragment_shader);
 
 int main(int argc, char **argv) {
+	//for reporting time-to-first-frame:
+	auto start_time = std::chrono::high_resolution_clock::now();
+
 	//Configuration:
 	struct {
 		std::string title = "Game1: Text/Tiles";
 		glm::uvec2 size = glm::uvec2(480, 480);
 	} config;
 
+	//Command-line options:
+	bool headless = false;
+	HeadlessConfig headless_config;
+	std::string decode_cache_dir = "decode-cache";
+	std::string capture_dir = "captures";
+	bool record_from_start = false;
+	auto usage = [&]() {
+		std::cerr << "Usage:\n\t" << argv[0] << " [--decode-cache DIR | --no-decode-cache] [--capture DIR] [--headless [--moves N] [--seed S] [--script FILE | --agents N [--threads T]] [--maze WxH]]" << std::endl;
+	};
+	for (int i = 1; i < argc; ++i) {
+		std::string arg = argv[i];
+		auto next = [&]() -> std::string {
+			if (i + 1 >= argc) throw std::runtime_error("expected a value after " + arg);
+			return argv[++i];
+		};
+		if (arg == "--headless") {
+			headless = true;
+		} else if (arg == "--decode-cache") {
+			decode_cache_dir = next();
+		} else if (arg == "--no-decode-cache") {
+			decode_cache_dir = "";
+		} else if (arg == "--capture") {
+			capture_dir = next();
+			record_from_start = true;
+		} else if (arg == "--moves") {
+			headless_config.moves = std::stoull(next());
+		} else if (arg == "--seed") {
+			headless_config.seed = std::stoull(next());
+		} else if (arg == "--script") {
+			headless_config.script = next();
+		} else if (arg == "--agents") {
+			headless_config.agents = std::stoul(next());
+		} else if (arg == "--threads") {
+			headless_config.threads = std::stoul(next());
+		} else if (arg == "--maze") {
+			std::string size = next();
+			//(parsed in 64 bits, so that neither dimension nor their product can wrap around)
+			char *end = nullptr;
+			unsigned long long width = std::strtoull(size.c_str(), &end, 10);
+			unsigned long long height = (*end == 'x' ? std::strtoull(end + 1, &end, 10) : 0);
+			if (*end != '\0' || width == 0 || height == 0 || width > Maze::MaxTiles || height > Maze::MaxTiles || width * height > Maze::MaxTiles) {
+				std::cerr << "--maze expects WIDTHxHEIGHT, both nonzero and at most " << Maze::MaxTiles << " tiles in all; got '" << size << "'." << std::endl;
+				usage();
+				return 1;
+			}
+			headless_config.width = uint32_t(width);
+			headless_config.height = uint32_t(height);
+		} else {
+			usage();
+			return 1;
+		}
+	}
+	//batch agents move randomly; a script only drives the single-agent simulation:
+	if (!headless_config.script.empty() && headless_config.agents) {
+		std::cerr << "--script can't be combined with --agents." << std::endl;
+		usage();
+		return 1;
+	}
+
+	//Headless mode skips window, context, and assets entirely:
+	if (headless) {
+		return run_headless(headless_config);
+	}
+
 	//------------  initialization ------------
 
+	//Lay out the texture atlas from image headers alone; pixels are decoded later, straight into
+	// a mapped pixel-unpack buffer (which needs the GL context).
+	//Images baked into 'assets.pack' (see bake.cpp) are copied from it instead of decoded;
+	// the rest are decoded once and then kept in the decode cache across runs:
+	ThreadPool pool;
+	AssetPack pack;
+	if (pack.open("assets.pack")) {
+		std::cout << "Using baked asset pack (" << pack.images.size() << " images)." << std::endl;
+	}
+	PngCache decode_cache(decode_cache_dir);
+	Atlas atlas;
+	AtlasLoader atlas_loader;
+	if (!atlas_loader.open({
+		"background.png",
+		"char.png",
+		"find_message.png",
+		"mine_message.png",
+		"found_message.png",
+	}, &atlas, &pack, &decode_cache)) {
+		std::cerr << "Failed to load texture atlas." << std::endl;
+		return 1;
+	}
+
 	//Initialize SDL library:
 	SDL_Init(SDL_INIT_VIDEO);
 
@@ -81,160 +193,44 @@ int main(int argc, char **argv) {
 
 	//------------ opengl objects / game assets ------------
 
-	//texture:
-	GLuint tex = 0;
-	glm::uvec2 tex_size = glm::uvec2(0,0);
-
-	{ //load texture 'tex':
-		std::vector< uint32_t > data;
-		if (!load_png("background.png", &tex_size.x, &tex_size.y, &data, LowerLeftOrigin)) {
-			std::cerr << "Failed to load texture." << std::endl;
-			exit(1);
-		}
-		//create a texture object:
-		glGenTextures(1, &tex);
-		//bind texture object to GL_TEXTURE_2D:
-		glBindTexture(GL_TEXTURE_2D, tex);
-		//upload texture data from data:
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, tex_size.x, tex_size.y, 0, GL_RGBA, GL_UNSIGNED_BYTE, &data[0]);
-		//set texture sampling parameters:
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-	}
-
-	GLuint tex2 = 0;
-	glm::uvec2 tex2_size = glm::uvec2(0,0);
-
-	{ //load texture 'tex2':
-		std::vector< uint32_t > data;
-		if (!load_png("char.png", &tex2_size.x, &tex2_size.y, &data, LowerLeftOrigin)) {
-			std::cerr << "Failed to load texture." << std::endl;
-			exit(1);
-		}
-		//create a texture object:
-		glGenTextures(1, &tex2);
-		//bind texture object to GL_TEXTURE_2D:
-		glBindTexture(GL_TEXTURE_2D, tex2);
-		//upload texture data from data:
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, tex2_size.x, tex2_size.y, 0, GL_RGBA, GL_UNSIGNED_BYTE, &data[0]);
-		//set texture sampling parameters:
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-	}
-
-	GLuint tex3 = 0;
-	glm::uvec2 tex3_size = glm::uvec2(0,0);
-
-	{ //load texture 'tex2':
-		std::vector< uint32_t > data;
-		if (!load_png("find_message.png", &tex3_size.x, &tex3_size.y, &data, LowerLeftOrigin)) {
-			std::cerr << "Failed to load texture." << std::endl;
-			exit(1);
-		}
-		//create a texture object:
-		glGenTextures(1, &tex3);
-		//bind texture object to GL_TEXTURE_2D:
-		glBindTexture(GL_TEXTURE_2D, tex3);
-		//upload texture data from data:
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, tex3_size.x, tex3_size.y, 0, GL_RGBA, GL_UNSIGNED_BYTE, &data[0]);
-		//set texture sampling parameters:
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-	}
-
-	GLuint tex4 = 0;
-	glm::uvec2 tex4_size = glm::uvec2(0,0);
-
-	{ //load texture 'tex2':
-		std::vector< uint32_t > data;
-		if (!load_png("mine_message.png", &tex4_size.x, &tex4_size.y, &data, LowerLeftOrigin)) {
-			std::cerr << "Failed to load texture." << std::endl;
-			exit(1);
-		}
-		//create a texture object:
-		glGenTextures(1, &tex4);
-		//bind texture object to GL_TEXTURE_2D:
-		glBindTexture(GL_TEXTURE_2D, tex4);
-		//upload texture data from data:
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, tex4_size.x, tex4_size.y, 0, GL_RGBA, GL_UNSIGNED_BYTE, &data[0]);
-		//set texture sampling parameters:
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-	}
-
-	GLuint tex5 = 0;
-	glm::uvec2 tex5_size = glm::uvec2(0,0);
-
-	{ //load texture 'tex2':
-		std::vector< uint32_t > data;
-		if (!load_png("found_message.png", &tex5_size.x, &tex5_size.y, &data, LowerLeftOrigin)) {
-			std::cerr << "Failed to load texture." << std::endl;
-			exit(1);
-		}
-		//create a texture object:
-		glGenTextures(1, &tex5);
-		//bind texture object to GL_TEXTURE_2D:
-		glBindTexture(GL_TEXTURE_2D, tex5);
-		//upload texture data from data:
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, tex5_size.x, tex5_size.y, 0, GL_RGBA, GL_UNSIGNED_BYTE, &data[0]);
-		//set texture sampling parameters:
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-	}
-
-	GLuint tex6 = 0;
-	glm::uvec2 tex6_size = glm::uvec2(0,0);
-
-	{ //load texture 'tex2':
-		std::vector< uint32_t > data;
-		if (!load_png("black_cover.png", &tex6_size.x, &tex6_size.y, &data, LowerLeftOrigin)) {
-			std::cerr << "Failed to load texture." << std::endl;
-			exit(1);
-		}
-		//create a texture object:
-		glGenTextures(1, &tex6);
-		//bind texture object to GL_TEXTURE_2D:
-		glBindTexture(GL_TEXTURE_2D, tex6);
-		//upload texture data from data:
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, tex6_size.x, tex6_size.y, 0, GL_RGBA, GL_UNSIGNED_BYTE, &data[0]);
-		//set texture sampling parameters:
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-	}
+	//Start decoding the atlas on worker threads, directly into driver memory, overlapping
+	// shader compilation and the rest of setup; only the upload (below) has to happen on this thread:
+	std::unique_ptr< PixelUpload > atlas_upload(new PixelUpload(atlas.size.x, atlas.size.y));
+	std::future< bool > atlas_decoded = std::async(std::launch::async, [&atlas_loader, &atlas_upload, &pool]() {
+		//(premultiplied, so edges blend and filter correctly; see glBlendFunc below)
+		return atlas_loader.decode(atlas_upload->pixels, &pool, PremultiplyAlpha);
+	});
 
 
 	//shader program:
 	GLuint program = 0;
-	GLuint program_Position = 0;
-	GLuint program_TexCoord = 0;
+	GLuint program_Corner = 0;
+	GLuint program_At = 0;
+	GLuint program_Radius = 0;
+	GLuint program_Angle = 0;
+	GLuint program_UVRect = 0;
 	GLuint program_Color = 0;
-	GLuint program_mvp = 0;
 	GLuint program_tex = 0;
 	{ //compile shader program:
+		//each sprite is one instance of a unit quad ('Corner' in [-1,1]x[-1,1]), placed by per-instance attributes:
 		GLuint vertex_shader = compile_shader(GL_VERTEX_SHADER,
-			"#version 330\n"
-			"uniform mat4 mvp;\n"
-			"in vec4 Position;\n"
-			"in vec2 TexCoord;\n"
+			std::string("#version 330\n")
+			+ CameraUniforms::GLSL +
+			"in vec2 Corner;\n"
+			"in vec2 At;\n"
+			"in vec2 Radius;\n"
+			"in float Angle;\n"
+			"in vec4 UVRect;\n" //(min uv, max uv)
 			"in vec4 Color;\n"
 			"out vec2 texCoord;\n"
 			"out vec4 color;\n"
 			"void main() {\n"
-			"	gl_Position = mvp * Position;\n"
+			"	vec2 right = vec2(cos(Angle), sin(Angle));\n"
+			"	vec2 up = vec2(-right.y, right.x);\n"
+			"	vec2 local = Corner * Radius;\n"
+			"	gl_Position = world_to_clip * vec4(At + right * local.x + up * local.y, 0.0, 1.0);\n"
 			"	color = Color;\n"
-			"	texCoord = TexCoord;\n"
+			"	texCoord = mix(UVRect.xy, UVRect.zw, 0.5 * Corner + 0.5);\n"
 			"}\n"
 		);
 
@@ -245,54 +241,116 @@ int main(int argc, char **argv) {
 			"in vec2 texCoord;\n"
 			"out vec4 fragColor;\n"
 			"void main() {\n"
-			"	fragColor = texture(tex, texCoord) * color;\n"
+			"	fragColor = texture(tex, texCoord) * vec4(color.rgb * color.a, color.a);\n"
 			"}\n"
 		);
 
 		program = link_program(fragment_shader, vertex_shader);
+		CameraUniforms::bind_block(program);
 
 		//look up attribute locations:
-		program_Position = glGetAttribLocation(program, "Position");
-		if (program_Position == -1U) throw std::runtime_error("no attribute named Position");
-		program_TexCoord = glGetAttribLocation(program, "TexCoord");
-		if (program_TexCoord == -1U) throw std::runtime_error("no attribute named TexCoord");
+		program_Corner = glGetAttribLocation(program, "Corner");
+		if (program_Corner == -1U) throw std::runtime_error("no attribute named Corner");
+		program_At = glGetAttribLocation(program, "At");
+		if (program_At == -1U) throw std::runtime_error("no attribute named At");
+		program_Radius = glGetAttribLocation(program, "Radius");
+		if (program_Radius == -1U) throw std::runtime_error("no attribute named Radius");
+		program_Angle = glGetAttribLocation(program, "Angle");
+		if (program_Angle == -1U) throw std::runtime_error("no attribute named Angle");
+		program_UVRect = glGetAttribLocation(program, "UVRect");
+		if (program_UVRect == -1U) throw std::runtime_error("no attribute named UVRect");
 		program_Color = glGetAttribLocation(program, "Color");
 		if (program_Color == -1U) throw std::runtime_error("no attribute named Color");
 
 		//look up uniform locations:
-		program_mvp = glGetUniformLocation(program, "mvp");
-		if (program_mvp == -1U) throw std::runtime_error("no uniform named mvp");
 		program_tex = glGetUniformLocation(program, "tex");
 		if (program_tex == -1U) throw std::runtime_error("no uniform named tex");
 	}
 
-	//vertex buffer:
-	GLuint buffer = 0;
-	{ //create vertex buffer
-		glGenBuffers(1, &buffer);
-		glBindBuffer(GL_ARRAY_BUFFER, buffer);
+	//per-sprite data (one instance of the unit quad), 32 bytes rather than six 20-byte strip vertices:
+	struct Sprite {
+		Sprite(glm::vec2 const &At_, glm::vec2 const &Radius_, float Angle_, glm::vec2 const &min_uv, glm::vec2 const &max_uv, glm::u8vec4 const &Color_) :
+			At(At_), Radius(Radius_), Angle(Angle_), Color(Color_) {
+			//(normalized 16-bit: ~1/30 of a texel even in a 2048-wide atlas)
+			auto unorm16 = [](float f) { return uint16_t(std::max(0.0f, std::min(1.0f, f)) * 65535.0f + 0.5f); };
+			UVRect = glm::u16vec4(unorm16(min_uv.x), unorm16(min_uv.y), unorm16(max_uv.x), unorm16(max_uv.y));
+		}
+		glm::vec2 At;
+		glm::vec2 Radius;
+		float Angle;
+		glm::u16vec4 UVRect;
+		glm::u8vec4 Color;
+	};
+	static_assert(sizeof(Sprite) == 32, "Sprite is nicely packed.");
+
+	//draw state changes (including those made while setting up the sprite quad and tilemap) go through this,
+	// which skips the ones that wouldn't change anything:
+	GlState gl_state;
+
+	//sprite buffer (triple-buffered ring, written in place every frame):
+	//(held by pointer so it can be released before the GL context is destroyed)
+	std::unique_ptr< VertexRing > ring(new VertexRing(sizeof(Sprite) * 64, sizeof(Sprite)));
+
+	//the unit quad every sprite is an instance of (its vao also holds the per-instance attributes):
+	std::unique_ptr< StaticMesh > sprite_quad;
+	{
+		glm::vec2 const corners[4] = {
+			glm::vec2(-1.0f,-1.0f),
+			glm::vec2(-1.0f, 1.0f),
+			glm::vec2( 1.0f,-1.0f),
+			glm::vec2( 1.0f, 1.0f),
+		};
+		sprite_quad.reset(new StaticMesh(corners, sizeof(corners), 4, [&](){
+			glVertexAttribPointer(program_Corner, 2, GL_FLOAT, GL_FALSE, sizeof(glm::vec2), (GLbyte *)0);
+			glEnableVertexAttribArray(program_Corner);
+			for (GLuint attrib : { program_At, program_Radius, program_Angle, program_UVRect, program_Color }) {
+				glVertexAttribDivisor(attrib, 1);
+				glEnableVertexAttribArray(attrib);
+			}
+		}, gl_state));
 	}
 
-	struct Vertex {
-		Vertex(glm::vec2 const &Position_, glm::vec2 const &TexCoord_, glm::u8vec4 const &Color_) :
-			Position(Position_), TexCoord(TexCoord_), Color(Color_) { }
-		glm::vec2 Position;
-		glm::vec2 TexCoord;
-		glm::u8vec4 Color;
+	//helper: point the per-instance attributes of the sprite vao (which must be bound) at the Sprites starting at byte 'offset' of the ring:
+	//(GL 3.3 has no base-instance draws, so this is redone for each ring segment)
+	auto set_sprite_attributes = [&](GLintptr offset) {
+		glBindBuffer(GL_ARRAY_BUFFER, ring->buffer);
+		GLbyte const *at = (GLbyte *)0 + offset;
+		glVertexAttribPointer(program_At, 2, GL_FLOAT, GL_FALSE, sizeof(Sprite), at + offsetof(Sprite, At));
+		glVertexAttribPointer(program_Radius, 2, GL_FLOAT, GL_FALSE, sizeof(Sprite), at + offsetof(Sprite, Radius));
+		glVertexAttribPointer(program_Angle, 1, GL_FLOAT, GL_FALSE, sizeof(Sprite), at + offsetof(Sprite, Angle));
+		glVertexAttribPointer(program_UVRect, 4, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(Sprite), at + offsetof(Sprite, UVRect));
+		glVertexAttribPointer(program_Color, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Sprite), at + offsetof(Sprite, Color));
 	};
-	static_assert(sizeof(Vertex) == 20, "Vertex is nicely packed.");
-
-	//vertex array object:
-	GLuint vao = 0;
-	{ //create vao and set up binding:
-		glGenVertexArrays(1, &vao);
-		glBindVertexArray(vao);
-		glVertexAttribPointer(program_Position, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (GLbyte *)0);
-		glVertexAttribPointer(program_TexCoord, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (GLbyte *)0 + sizeof(glm::vec2));
-		glVertexAttribPointer(program_Color, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), (GLbyte *)0 + sizeof(glm::vec2) + sizeof(glm::vec2));
-		glEnableVertexAttribArray(program_Position);
-		glEnableVertexAttribArray(program_TexCoord);
-		glEnableVertexAttribArray(program_Color);
+
+	//texture atlas holding every sprite image:
+	GLuint tex = 0;
+
+	{ //wait for atlas to finish decoding and upload as texture 'tex':
+		if (!atlas_decoded.get()) {
+			std::cerr << "Failed to load texture atlas." << std::endl;
+			exit(1);
+		}
+		std::cout << "Assets ready after " << std::chrono::duration< float, std::milli >(std::chrono::high_resolution_clock::now() - start_time).count() << "ms." << std::endl;
+		//create a texture object:
+		glGenTextures(1, &tex);
+		//upload texture data from the unpack buffer (binds 'tex' to GL_TEXTURE_2D, even if it fails):
+		if (!atlas_upload->finish(tex)) {
+			//mapped memory was lost (rare; e.g. a mode switch), so decode again the slow way (into the still-bound 'tex'):
+			std::vector< uint32_t > data(atlas.size.x * atlas.size.y);
+			if (!atlas_loader.decode(&data[0], &pool, PremultiplyAlpha)) {
+				std::cerr << "Failed to load texture atlas." << std::endl;
+				exit(1);
+			}
+			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, atlas.size.x, atlas.size.y, 0, GL_RGBA, GL_UNSIGNED_BYTE, &data[0]);
+		}
+		atlas_upload.reset();
+		//set texture sampling parameters:
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		//(PixelUpload binds 'tex' itself, behind gl_state's back)
+		gl_state.invalidate();
 	}
 
 	//------------ sprite info ------------
@@ -303,12 +361,21 @@ int main(int argc, char **argv) {
 	};
 
 
-	auto load_sprite = [](std::string const &name) -> SpriteInfo {
+	auto load_sprite = [&atlas](std::string const &name) -> SpriteInfo {
+		auto f = atlas.entries.find(name);
+		if (f == atlas.entries.end()) throw std::runtime_error("no sprite named " + name + " in atlas");
 		SpriteInfo info;
-		//TODO: look up sprite name in table of sprite infos
+		info.min_uv = f->second.min_uv;
+		info.max_uv = f->second.max_uv;
 		return info;
 	};
 
+	SpriteInfo const background_sprite = load_sprite("background.png");
+	SpriteInfo const char_sprite = load_sprite("char.png");
+	SpriteInfo const find_sprite = load_sprite("find_message.png");
+	SpriteInfo const mine_sprite = load_sprite("mine_message.png");
+	SpriteInfo const found_sprite = load_sprite("found_message.png");
+
 
 	//------------ game state ------------
 
@@ -321,23 +388,14 @@ int main(int argc, char **argv) {
 	//correct radius for aspect ratio:
 	camera.radius.x = camera.radius.y * (float(config.size.x) / float(config.size.y));
 
-	// list the possible moves for each tile (up, left, down, right)
-	int neighbors[30][4] = {{0,0,0,1}, {0,1,1,1}, {0,1,1,1}, {0,1,1,0}, {0,0,1,0},
-							{0,0,1,0}, {1,0,0,0}, {1,0,1,1}, {1,1,1,0}, {1,0,1,0},
-							{1,0,0,1}, {0,1,0,1}, {1,1,1,0}, {1,0,0,1}, {1,1,0,0},
-							{0,0,1,0}, {0,0,1,1}, {1,1,0,1}, {0,1,1,1}, {0,1,1,0},
-							{1,0,1,0}, {1,0,1,0}, {0,0,1,0}, {1,0,1,0}, {1,0,0,0},
-							{1,0,0,1}, {1,1,0,1}, {1,1,0,1}, {1,1,0,1}, {0,1,0,0}};
+	//view data for every program, uploaded only when the camera changes:
+	std::unique_ptr< CameraUniforms > camera_uniforms(new CameraUniforms());
 
-	int visited_tiles[30];
+	//the cave: passages between tiles, plus visited, mine, and treasure tiles:
+	Maze maze = Maze::cave();
 
-	for (int t = 0; t < 30; t++){
-		visited_tiles[t] = 0;
-	}
-	
-	int current_row = 3;
-	int current_col = 2;
-	visited_tiles[current_row * 5 + current_col] = 1;
+	int current_row = maze.row(maze.start);
+	int current_col = maze.col(maze.start);
 
 	float player_x = 0.0;
 	float player_y = 0.0;
@@ -346,46 +404,141 @@ int main(int argc, char **argv) {
 	bool display_mine = false;
 	bool display_found = false;
 
+	//------------ tilemap ------------
+	//the maze is drawn from a texture of tile indices, using tiles cut from background.png;
+	// unexplored tiles are hidden by the tilemap's fog-of-war mask.
+
+	std::unique_ptr< Tilemap > tilemap;
+	{ //create tilemap for the 5x6 maze:
+		//tile grid, as measured from the artwork (background.png spans [-10,10]x[-10,10] in world units):
+		glm::uvec2 const maze_size = glm::uvec2(maze.width, maze.height);
+		glm::vec2 const maze_origin = glm::vec2(-9.1f, 9.0f);
+		glm::vec2 const maze_tile_size = glm::vec2(3.7f, 2.6f);
+
+		//tileset is the same grid, in background sprite texture coordinates:
+		SpriteInfo const &sprite = background_sprite;
+		auto world_to_uv = [&sprite](glm::vec2 const &at) {
+			return sprite.min_uv + (at + glm::vec2(10.0f)) / 20.0f * (sprite.max_uv - sprite.min_uv);
+		};
+		Tilemap::Tileset tileset;
+		tileset.origin_uv = world_to_uv(maze_origin);
+		tileset.cell_uv = (world_to_uv(maze_tile_size * glm::vec2(1.0f,-1.0f)) - world_to_uv(glm::vec2(0.0f)));
+		tileset.columns = maze_size.x;
+
+		tilemap.reset(new Tilemap(maze_size, maze_origin, maze_tile_size, tileset, gl_state));
+
+		//each maze tile shows its own cell of the tileset:
+		std::vector< uint16_t > ids(maze_size.x * maze_size.y);
+		for (uint32_t t = 0; t < ids.size(); ++t) {
+			ids[t] = t;
+		}
+		tilemap->set_tiles(ids, gl_state);
+
+		for (uint32_t t = 0; t < maze.width * maze.height; ++t) {
+			if (maze.visited.get(t)) tilemap->reveal(glm::uvec2(maze.col(t), maze.row(t)));
+		}
+	}
+
 	//------------ game loop ------------
 
+	//redraw only when something visible has changed; otherwise the last presented frame stays on screen:
+	bool dirty = true;
+
+	//while idle, wake up at least this often (milliseconds):
+	const int IdleWaitTimeout = 250;
+
 	bool should_quit = false;
+
+	//per-phase CPU time of each drawn frame; F10 (and quitting) prints percentiles:
+	//(on the heap, since it holds a few thousand samples)
+	std::unique_ptr< FrameProfiler > profiler(new FrameProfiler());
+	//GPU time of each pass (the ones before GpuFrame) and of the whole frame, reported along with it:
+	std::unique_ptr< GpuTimer > gpu_timer(new GpuTimer(FrameProfiler::GpuFrame));
+
+	//frame capture: F12 saves a screenshot, F11 starts/stops recording every frame
+	// (--capture DIR records from the start); PNGs are written in the background:
+	std::unique_ptr< FrameCapture > capture;
+	bool recording = record_from_start;
+	bool screenshot = false;
+	uint32_t screenshot_index = 0;
+	uint32_t record_index = 0;
+
+	//helper: move the explorer in 'dir', if the maze has a passage that way:
+	auto move = [&](Direction dir) {
+		uint32_t at = maze.tile(current_row, current_col);
+		if (!maze.move(&at, dir)) return;
+		current_row = maze.row(at);
+		current_col = maze.col(at);
+		tilemap->reveal(glm::uvec2(current_col, current_row));
+		dirty = true;
+	};
+
+	//helper: apply one event to the game state, marking the frame dirty if anything visible changed:
+	auto handle_event = [&](SDL_Event const &evt) {
+		//handle input:
+		if (evt.type == SDL_MOUSEMOTION) {
+			mouse.x = (evt.motion.x + 0.5f) / float(config.size.x) * 2.0f - 1.0f;
+			mouse.y = (evt.motion.y + 0.5f) / float(config.size.y) *-2.0f + 1.0f;
+		} else if (evt.type == SDL_MOUSEBUTTONDOWN) {
+		} else if (evt.type == SDL_KEYDOWN && evt.key.keysym.sym == SDLK_ESCAPE) {
+			should_quit = true;
+		} else if (evt.type == SDL_KEYDOWN && evt.key.keysym.sym == SDLK_UP) {
+			move(Up);
+		} else if (evt.type == SDL_KEYDOWN && evt.key.keysym.sym == SDLK_LEFT) {
+			move(Left);
+		} else if (evt.type == SDL_KEYDOWN && evt.key.keysym.sym == SDLK_DOWN) {
+			move(Down);
+		} else if (evt.type == SDL_KEYDOWN && evt.key.keysym.sym == SDLK_RIGHT) {
+			move(Right);
+		} else if (evt.type == SDL_KEYDOWN && evt.key.keysym.sym == SDLK_F12) {
+			screenshot = true;
+			dirty = true;
+		} else if (evt.type == SDL_KEYDOWN && evt.key.keysym.sym == SDLK_F10) {
+			profiler->report(std::cout);
+			gl_state.report(std::cout);
+			#ifdef GL_TRACE
+			gl_trace::report(std::cout);
+			#endif
+		} else if (evt.type == SDL_KEYDOWN && evt.key.keysym.sym == SDLK_F11) {
+			recording = !recording;
+			std::cout << (recording ? "Recording" : "Stopped recording") << " frames to '" << capture_dir << "'." << std::endl;
+		} else if (evt.type == SDL_WINDOWEVENT) {
+			//window contents may have been lost or resized:
+			dirty = true;
+		} else if (evt.type == SDL_QUIT) {
+			should_quit = true;
+		}
+	};
+
 	while (true) {
 		static SDL_Event evt;
-		while (SDL_PollEvent(&evt) == 1) {
-			//handle input:
-			if (evt.type == SDL_MOUSEMOTION) {
-				mouse.x = (evt.motion.x + 0.5f) / float(config.size.x) * 2.0f - 1.0f;
-				mouse.y = (evt.motion.y + 0.5f) / float(config.size.y) *-2.0f + 1.0f;
-			} else if (evt.type == SDL_MOUSEBUTTONDOWN) {
-			} else if (evt.type == SDL_KEYDOWN && evt.key.keysym.sym == SDLK_ESCAPE) {
-				should_quit = true;
-			} else if (evt.type == SDL_KEYDOWN && evt.key.keysym.sym == SDLK_UP) {
-				if (neighbors[current_row * 5 + current_col][0] == 1){
-					current_row -= 1;
-					visited_tiles[current_row * 5 + current_col] = 1;
-				}
-			} else if (evt.type == SDL_KEYDOWN && evt.key.keysym.sym == SDLK_LEFT) {
-				if (neighbors[current_row * 5 + current_col][1] == 1){
-					current_col -= 1;
-					visited_tiles[current_row * 5 + current_col] = 1;
-				}
-			} else if (evt.type == SDL_KEYDOWN && evt.key.keysym.sym == SDLK_DOWN) {
-				if (neighbors[current_row * 5 + current_col][2] == 1){
-					current_row += 1;
-					visited_tiles[current_row * 5 + current_col] = 1;
-				}
-			} else if (evt.type == SDL_KEYDOWN && evt.key.keysym.sym == SDLK_RIGHT) {
-				if (neighbors[current_row * 5 + current_col][3] == 1){
-					current_col += 1;
-					visited_tiles[current_row * 5 + current_col] = 1;
-				}
-			} else if (evt.type == SDL_QUIT) {
-				should_quit = true;
-				break;
+		if (!dirty) {
+			//nothing to draw: sleep until input arrives instead of spinning on vsync:
+			if (SDL_WaitEventTimeout(&evt, IdleWaitTimeout) == 1) {
+				handle_event(evt);
 			}
 		}
+		//(time spent idle, above, isn't part of any frame)
+		profiler->begin_frame();
+		#ifdef GL_TRACE
+		gl_trace::begin_frame();
+		#endif
+		while (!should_quit && SDL_PollEvent(&evt) == 1) {
+			handle_event(evt);
+		}
 		if (should_quit) break;
 
+		if ((recording || screenshot) && !capture) {
+			capture.reset(new FrameCapture(capture_dir, &pool));
+		}
+		if (capture) {
+			//hand off any finished readbacks; never waits on the GPU:
+			capture->poll();
+		}
+		//a recording gets every frame, not just the changed ones:
+		if (recording) dirty = true;
+		profiler->mark(FrameProfiler::EventPoll);
+
 		auto current_time = std::chrono::high_resolution_clock::now();
 		static auto previous_time = current_time;
 		float elapsed = std::chrono::duration< float >(current_time - previous_time).count();
@@ -393,219 +546,196 @@ int main(int argc, char **argv) {
 
 		{ //update game state:
 			(void)elapsed;
+
+			bool old_find = display_find;
+			bool old_mine = display_mine;
+			bool old_found = display_found;
+
+			uint32_t at = maze.tile(current_row, current_col);
+			if (maze.treasure.get(at)) {
+				display_find = false;
+				display_mine = false;
+				display_found = true;
+			} else if (maze.mines.get(at)) {
+				display_find = false;
+				display_mine = true;
+				display_found = false;
+			} else {
+				display_find = true;
+				display_mine = false;
+				display_found = false;
+			}
+
+			if (old_find != display_find || old_mine != display_mine || old_found != display_found) {
+				dirty = true;
+			}
+		}
+
+		profiler->mark(FrameProfiler::Update);
+
+		if (!dirty) continue;
+		dirty = false;
+
+		//collect GPU times from a couple of frames ago (if the GPU is done with them):
+		gpu_timer->begin_frame();
+		if (gpu_timer->ready) {
+			for (uint32_t p = 0; p < FrameProfiler::GpuFrame; ++p) {
+				profiler->gpu(FrameProfiler::GpuPass(p), gpu_timer->pass_ms[p]);
+			}
+			profiler->gpu(FrameProfiler::GpuFrame, gpu_timer->frame_ms);
 		}
 
 		//draw output:
 		glClearColor(0.5, 0.5, 0.5, 0.0);
 		glClear(GL_COLOR_BUFFER_BIT);
-		glEnable(GL_BLEND);
-		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+		gl_state.enable(GL_BLEND);
+		//(atlas colors are premultiplied by alpha)
+		gl_state.blend_func(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+		profiler->mark(FrameProfiler::Draw);
 
 
 		{ //draw game state:
-			std::vector< Vertex > verts;
-			std::vector< Vertex > verts_char;
-			std::vector< Vertex > verts_find;
-			std::vector< Vertex > verts_mine;
-			std::vector< Vertex > verts_found;
-			std::vector< Vertex > verts_cover;
-
-			//helper: add rectangle to verts:
-			auto rect = [&verts](glm::vec2 const &at, glm::vec2 const &rad, glm::u8vec4 const &tint) {
-				verts.emplace_back(at + glm::vec2(-rad.x,-rad.y), glm::vec2(0.0f, 0.0f), tint);
-				verts.emplace_back(verts.back());
-				verts.emplace_back(at + glm::vec2(-rad.x, rad.y), glm::vec2(0.0f, 1.0f), tint);
-				verts.emplace_back(at + glm::vec2( rad.x,-rad.y), glm::vec2(1.0f, 0.0f), tint);
-				verts.emplace_back(at + glm::vec2( rad.x, rad.y), glm::vec2(1.0f, 1.0f), tint);
-				verts.emplace_back(verts.back());
-			};
-
-			//helper: add character to game
-			auto character = [&verts_char](glm::vec2 const &at, glm::vec2 const &rad, glm::u8vec4 const &tint) {
-				verts_char.emplace_back(at + glm::vec2(-rad.x,-rad.y), glm::vec2(0.0f, 0.0f), tint);
-				verts_char.emplace_back(verts_char.back());
-				verts_char.emplace_back(at + glm::vec2(-rad.x, rad.y), glm::vec2(0.0f, 1.0f), tint);
-				verts_char.emplace_back(at + glm::vec2( rad.x,-rad.y), glm::vec2(1.0f, 0.0f), tint);
-				verts_char.emplace_back(at + glm::vec2( rad.x, rad.y), glm::vec2(1.0f, 1.0f), tint);
-				verts_char.emplace_back(verts_char.back());
-			};
-
-			//helper: add find message to game
-			auto find_mess = [&verts_find](glm::vec2 const &at, glm::vec2 const &rad, glm::u8vec4 const &tint) {
-				verts_find.emplace_back(at + glm::vec2(-2.5*rad.x,-0.4*rad.y), glm::vec2(0.0f, 0.0f), tint);
-				verts_find.emplace_back(verts_find.back());
-				verts_find.emplace_back(at + glm::vec2(-2.5*rad.x, 0.4*rad.y), glm::vec2(0.0f, 1.0f), tint);
-				verts_find.emplace_back(at + glm::vec2( 2.5*rad.x,-0.4*rad.y), glm::vec2(1.0f, 0.0f), tint);
-				verts_find.emplace_back(at + glm::vec2( 2.5*rad.x, 0.4*rad.y), glm::vec2(1.0f, 1.0f), tint);
-				verts_find.emplace_back(verts_find.back());
-			};
-
-			//helper: add mine message to game
-			auto mine_mess = [&verts_mine](glm::vec2 const &at, glm::vec2 const &rad, glm::u8vec4 const &tint) {
-				verts_mine.emplace_back(at + glm::vec2(-2.5*rad.x,-0.4*rad.y), glm::vec2(0.0f, 0.0f), tint);
-				verts_mine.emplace_back(verts_mine.back());
-				verts_mine.emplace_back(at + glm::vec2(-2.5*rad.x, 0.4*rad.y), glm::vec2(0.0f, 1.0f), tint);
-				verts_mine.emplace_back(at + glm::vec2( 2.5*rad.x,-0.4*rad.y), glm::vec2(1.0f, 0.0f), tint);
-				verts_mine.emplace_back(at + glm::vec2( 2.5*rad.x, 0.4*rad.y), glm::vec2(1.0f, 1.0f), tint);
-				verts_mine.emplace_back(verts_mine.back());
+			//every sprite lives in the atlas, so all of them are instances of one quad,
+			// written straight into the mapped ring segment:
+			//(background, drawn behind the tilemap, then character + message, drawn over it)
+			uint32_t const max_sprites = 3;
+			Sprite *sprites = reinterpret_cast< Sprite * >(ring->map(sizeof(Sprite) * max_sprites));
+			uint32_t sprites_count = 0;
+
+			//helper: add a sprite instance:
+			//NOTE: mapped memory may be write-combined, so sprites are only ever written, never read back.
+			auto emit = [&sprites, &sprites_count, &max_sprites](Sprite const &s) {
+				assert(sprites_count < max_sprites);
+				sprites[sprites_count++] = s;
 			};
 
-			//helper: add found message to game
-			auto found_mess = [&verts_found](glm::vec2 const &at, glm::vec2 const &rad, glm::u8vec4 const &tint) {
-				verts_found.emplace_back(at + glm::vec2(-2.5*rad.x,-0.4*rad.y), glm::vec2(0.0f, 0.0f), tint);
-				verts_found.emplace_back(verts_found.back());
-				verts_found.emplace_back(at + glm::vec2(-2.5*rad.x, 0.4*rad.y), glm::vec2(0.0f, 1.0f), tint);
-				verts_found.emplace_back(at + glm::vec2( 2.5*rad.x,-0.4*rad.y), glm::vec2(1.0f, 0.0f), tint);
-				verts_found.emplace_back(at + glm::vec2( 2.5*rad.x, 0.4*rad.y), glm::vec2(1.0f, 1.0f), tint);
-				verts_found.emplace_back(verts_found.back());
+			//helper: add rectangle showing (part of the atlas) 'sprite':
+			auto rect = [&emit](SpriteInfo const &sprite, glm::vec2 const &at, glm::vec2 const &rad, glm::u8vec4 const &tint) {
+				emit(Sprite(at, rad, 0.0f, sprite.min_uv, sprite.max_uv, tint));
 			};
 
-			//helper: add cover message to game
-			auto cover = [&verts_cover](glm::vec2 const &at, glm::vec2 const &rad, glm::u8vec4 const &tint) {
-				verts_cover.emplace_back(at + glm::vec2(-2*rad.x,-1.5*rad.y), glm::vec2(0.0f, 0.0f), tint);
-				verts_cover.emplace_back(verts_cover.back());
-				verts_cover.emplace_back(at + glm::vec2(-2*rad.x, 1.5*rad.y), glm::vec2(0.0f, 1.0f), tint);
-				verts_cover.emplace_back(at + glm::vec2( 2*rad.x,-1.5*rad.y), glm::vec2(1.0f, 0.0f), tint);
-				verts_cover.emplace_back(at + glm::vec2( 2*rad.x, 1.5*rad.y), glm::vec2(1.0f, 1.0f), tint);
-				verts_cover.emplace_back(verts_cover.back());
+			//helper: add character to game
+			auto character = [&rect,&char_sprite](glm::vec2 const &at, glm::vec2 const &rad, glm::u8vec4 const &tint) {
+				rect(char_sprite, at, rad, tint);
 			};
 
-			auto draw_sprite = [&verts](SpriteInfo const &sprite, glm::vec2 const &at, float angle = 0.0f) {
-				glm::vec2 min_uv = sprite.min_uv;
-				glm::vec2 max_uv = sprite.max_uv;
-				glm::vec2 rad = sprite.rad;
-				glm::u8vec4 tint = glm::u8vec4(0xff, 0xff, 0xff, 0xff);
-				glm::vec2 right = glm::vec2(std::cos(angle), std::sin(angle));
-				glm::vec2 up = glm::vec2(-right.y, right.x);
-
-				verts.emplace_back(at + right * -rad.x + up * -rad.y, glm::vec2(min_uv.x, min_uv.y), tint);
-				verts.emplace_back(verts.back());
-				verts.emplace_back(at + right * -rad.x + up * rad.y, glm::vec2(min_uv.x, max_uv.y), tint);
-				verts.emplace_back(at + right *  rad.x + up * -rad.y, glm::vec2(max_uv.x, min_uv.y), tint);
-				verts.emplace_back(at + right *  rad.x + up *  rad.y, glm::vec2(max_uv.x, max_uv.y), tint);
-				verts.emplace_back(verts.back());
+			//helper: add a message (find, mine, or found) to game
+			auto message = [&rect](SpriteInfo const &sprite, glm::vec2 const &at, glm::vec2 const &rad, glm::u8vec4 const &tint) {
+				rect(sprite, at, glm::vec2(2.5f * rad.x, 0.4f * rad.y), tint);
 			};
 
 
-			//Draw a sprite "player" at position (5.0, 2.0):
-			static SpriteInfo player = load_sprite("player"); //TODO: hoist
-
+			//draw our game ccomponents (in back-to-front order; maze is drawn by tilemap, over the background)
+			//(background.png spans [-10,10]x[-10,10] in world units; the tilemap covers only its maze)
+			rect(background_sprite, glm::vec2(0.0f), glm::vec2(10.0f), glm::u8vec4(0xff, 0xff, 0xff, 0xff));
 
-			//draw our game ccomponents
-			rect(glm::vec2(0.0f, 0.0f), glm::vec2(10.0f), glm::u8vec4(0xff, 0xff, 0xff, 0xff));
-
-			player_x = -8.0f + (current_col * 4.0f);
-			player_y = 8.0f - (current_row * 2.5f);
+			glm::vec2 player_at = tilemap->tile_center(glm::uvec2(current_col, current_row));
+			player_x = player_at.x;
+			player_y = player_at.y;
 			character(glm::vec2(player_x, player_y), glm::vec2(0.8f), glm::u8vec4(0xff, 0xff, 0xff, 0xff));
 
-			if (current_row == 0 && current_col == 4) {
-				display_find = false;
-				display_mine = false;
-				display_found = true;
-			} else if ((current_row == 1 && current_col == 0) || (current_row == 3 && current_col == 0) ||
-					   (current_row == 4 && current_col == 2) || (current_row == 5 && current_col == 4)){
-				display_find = false;
-				display_mine = true;
-				display_found = false;
-			} else {
-				display_find = true;
-				display_mine = false;
-				display_found = false;
-			}
-
 			if (display_find) {
-				find_mess(glm::vec2(0.0f, -8.5f), glm::vec2(4.0f), glm::u8vec4(0xff, 0xff, 0xff, 0xff));
+				message(find_sprite, glm::vec2(0.0f, -8.5f), glm::vec2(4.0f), glm::u8vec4(0xff, 0xff, 0xff, 0xff));
 			}
 
 			if (display_mine) {
-				mine_mess(glm::vec2(0.0f, -8.5f), glm::vec2(4.0f), glm::u8vec4(0xff, 0xff, 0xff, 0xff));
+				message(mine_sprite, glm::vec2(0.0f, -8.5f), glm::vec2(4.0f), glm::u8vec4(0xff, 0xff, 0xff, 0xff));
 			}
 			
 			if (display_found){
-				found_mess(glm::vec2(0.0f, -8.5f), glm::vec2(4.0f), glm::u8vec4(0xff, 0xff, 0xff, 0xff));
+				message(found_sprite, glm::vec2(0.0f, -8.5f), glm::vec2(4.0f), glm::u8vec4(0xff, 0xff, 0xff, 0xff));
 			}
 			
 
-			float start_x;
-			float start_y;
-
-			for (int row = 0; row < 6; row++){
-				for (int col = 0; col < 5; col++){
-					if (visited_tiles[(row * 5) + col] == 0){
-						start_x = -8.0f + (col * 4.0f);
-						start_y = 8.5f - (row * 3.0f);
-						cover(glm::vec2(start_x, start_y), glm::vec2(1.0f), glm::u8vec4(0xff, 0xff, 0xff, 0xff));
-					}
-				}
-			}
-
-			//cover(glm::vec2(0.0f, -0.5f), glm::vec2(1.0f), glm::u8vec4(0xff, 0xff, 0xff, 0xff));
-			//cover(glm::vec2(0.0f, 8.5f), glm::vec2(1.0f), glm::u8vec4(0xff, 0xff, 0xff, 0xff));
-
-			glBindBuffer(GL_ARRAY_BUFFER, buffer);
-			glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex) * verts.size(), &verts[0], GL_STREAM_DRAW);
+			profiler->mark(FrameProfiler::VertexBuild);
+			GLintptr sprites_offset = ring->unmap(sizeof(Sprite) * sprites_count);
+			profiler->mark(FrameProfiler::Upload);
 
-			glUseProgram(program);
-			glUniform1i(program_tex, 0);
 			glm::vec2 scale = 1.0f / camera.radius;
 			glm::vec2 offset = scale * -camera.at;
-			glm::mat4 mvp = glm::mat4(
+			camera_uniforms->set(glm::mat4(
 				glm::vec4(scale.x, 0.0f, 0.0f, 0.0f),
 				glm::vec4(0.0f, scale.y, 0.0f, 0.0f),
 				glm::vec4(0.0f, 0.0f, 1.0f, 0.0f),
 				glm::vec4(offset.x, offset.y, 0.0f, 1.0f)
-			);
-			glUniformMatrix4fv(program_mvp, 1, GL_FALSE, glm::value_ptr(mvp));
-
-			glBindTexture(GL_TEXTURE_2D, tex);
-
-			glBindVertexArray(vao);
-
-			glDrawArrays(GL_TRIANGLE_STRIP, 0, verts.size());
-
-			//tex2
-			glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex) * verts_char.size(), &verts_char[0], GL_STREAM_DRAW);
-
-			glBindTexture(GL_TEXTURE_2D, tex2);
-
-			glDrawArrays(GL_TRIANGLE_STRIP, 0, verts_char.size());
-
-			//tex3
-			glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex) * verts_find.size(), &verts_find[0], GL_STREAM_DRAW);
-
-			glBindTexture(GL_TEXTURE_2D, tex3);
-
-			glDrawArrays(GL_TRIANGLE_STRIP, 0, verts_find.size());
-
-			//tex3
-			glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex) * verts_mine.size(), &verts_mine[0], GL_STREAM_DRAW);
-
-			glBindTexture(GL_TEXTURE_2D, tex4);
-
-			glDrawArrays(GL_TRIANGLE_STRIP, 0, verts_mine.size());
-
-			//tex3
-			glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex) * verts_found.size(), &verts_found[0], GL_STREAM_DRAW);
-
-			glBindTexture(GL_TEXTURE_2D, tex5);
+			));
+
+			//helper: draw sprites [first, first + count) of this frame's segment:
+			auto draw_sprites = [&](uint32_t first, uint32_t count) {
+				gl_state.use_program(program);
+				gl_state.uniform1i(program_tex, 0);
+				gl_state.bind_texture(0, tex);
+				gl_state.bind_vertex_array(sprite_quad->vao);
+				set_sprite_attributes(sprites_offset + GLintptr(sizeof(Sprite)) * first);
+				glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, sprite_quad->count, count);
+			};
 
-			glDrawArrays(GL_TRIANGLE_STRIP, 0, verts_found.size());
+			//(the background is timed along with the tilemap it sits behind)
+			gpu_timer->begin(FrameProfiler::GpuTilemap);
+			draw_sprites(0, 1);
+			tilemap->draw(tex, gl_state);
+			gpu_timer->end();
 
-			//tex3
-			glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex) * verts_cover.size(), &verts_cover[0], GL_STREAM_DRAW);
+			gpu_timer->begin(FrameProfiler::GpuSprites);
+			draw_sprites(1, sprites_count - 1);
+			gpu_timer->end();
 
-			glBindTexture(GL_TEXTURE_2D, tex6);
+			ring->fence();
+		}
 
-			glDrawArrays(GL_TRIANGLE_STRIP, 0, verts_cover.size());
+		if (recording || screenshot) {
+			int width = 0, height = 0;
+			SDL_GL_GetDrawableSize(window, &width, &height);
+			char name[64];
+			if (recording) {
+				snprintf(name, sizeof(name), "frame-%06u.png", record_index++);
+				capture->capture(name, width, height);
+			}
+			if (screenshot) {
+				snprintf(name, sizeof(name), "screenshot-%04u.png", screenshot_index++);
+				capture->capture(name, width, height);
+				std::cout << "Saving " << capture_dir << "/" << name << std::endl;
+				screenshot = false;
+			}
 		}
 
+		gpu_timer->end_frame();
+		profiler->mark(FrameProfiler::Draw);
 
 		SDL_GL_SwapWindow(window);
+		profiler->mark(FrameProfiler::Swap);
+		profiler->end_frame();
+		#ifdef GL_TRACE
+		gl_trace::end_frame();
+		#endif
+
+		static bool reported_first_frame = false;
+		if (!reported_first_frame) {
+			reported_first_frame = true;
+			std::cout << "Time to first frame: " << std::chrono::duration< float, std::milli >(std::chrono::high_resolution_clock::now() - start_time).count() << "ms." << std::endl;
+		}
 	}
 
 
 	//------------  teardown ------------
 
+	profiler->report(std::cout);
+	gl_state.report(std::cout);
+	#ifdef GL_TRACE
+	gl_trace::report(std::cout);
+	#endif
+
+	if (capture) {
+		std::cout << "Captured " << capture->written << " frames to '" << capture_dir << "' (" << capture->dropped << " dropped); finishing writes..." << std::endl;
+		//(waits for outstanding readbacks and PNG writes)
+		capture.reset();
+	}
+	gpu_timer.reset();
+	tilemap.reset();
+	camera_uniforms.reset();
+	sprite_quad.reset();
+	ring.reset();
+
 	SDL_GL_DeleteContext(context);
 	context = 0;
 
@@ -614,47 +744,3 @@ int main(int argc, char **argv) {
 
 	return 0;
 }
-
-
-
-static GLuint compile_shader(GLenum type, std::string const &source) {
-	GLuint shader = glCreateShader(type);
-	GLchar const *str = source.c_str();
-	GLint length = source.size();
-	glShaderSource(shader, 1, &str, &length);
-	glCompileShader(shader);
-	GLint compile_status = GL_FALSE;
-	glGetShaderiv(shader, GL_COMPILE_STATUS, &compile_status);
-	if (compile_status != GL_TRUE) {
-		std::cerr << "Failed to compile shader." << std::endl;
-		GLint info_log_length = 0;
-		glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &info_log_length);
-		std::vector< GLchar > info_log(info_log_length, 0);
-		GLsizei length = 0;
-		glGetShaderInfoLog(shader, info_log.size(), &length, &info_log[0]);
-		std::cerr << "Info log: " << std::string(info_log.begin(), info_log.begin() + length);
-		glDeleteShader(shader);
-		throw std::runtime_error("Failed to compile shader.");
-	}
-	return shader;
-}
-
-static GLuint link_program(GLuint fragment_shader, GLuint vertex_shader) {
-	GLuint program = glCreateProgram();
-	glAttachShader(program, vertex_shader);
-	glAttachShader(program, fragment_shader);
-	glLinkProgram(program);
-	GLint link_status = GL_FALSE;
-	glGetProgramiv(program, GL_LINK_STATUS, &link_status);
-	if (link_status != GL_TRUE) {
-		std::cerr << "Failed to link shader program." << std::endl;
-		GLint info_log_length = 0;
-		glGetProgramiv(program, GL_INFO_LOG_LENGTH, &info_log_length);
-		std::vector< GLchar > info_log(info_log_length, 0);
-		GLsizei length = 0;
-		glGetProgramInfoLog(program, info_log.size(), &length, &info_log[0]);
-		std::cerr << "Info log: " << std::string(info_log.begin(), info_log.begin() + length);
-		throw std::runtime_error("Failed to link program");
-	}
-	return program;
-}
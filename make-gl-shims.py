@@ -1,11 +1,14 @@
 #!/usr/bin/env python3
 
 #create gl_shims.hpp by parsing everything from glcorearb.h (why not the regsistry xml, hmmmm?) and selecting only things that are core through version 3_3.
+#with --trace, instead create gl_trace.hpp: wrappers around those same functions that count and time every call (see gl_trace.cpp).
 
 import re
+import sys
 
 protos = []
 extensions = []
+traced = [] #(return type, name, parameter list) of every function through 3_3
 
 with open('glcorearb.h', 'r') as f:
 	in_version = None
@@ -20,13 +23,17 @@ with open('glcorearb.h', 'r') as f:
 				protos.append("\n// " + in_version + " prototypes:\n")
 				do_proto = True
 				do_extension = False
-			elif (major,minor) < (3,3):
+			elif (major,minor) <= (3,3):
 				extensions.append("\n// " + in_version + " extensions:\n")
 				do_proto = False
 				do_extension = True
 			else:
 				do_proto = False
 				do_extension = False
+		if in_version and (do_proto or do_extension):
+			m = re.match(r"^GLAPI (.*?)\s*APIENTRY gl([^ ]+) \((.*)\);$", line)
+			if m != None:
+				traced.append((m.group(1), m.group(2), m.group(3)))
 		if in_version:
 			if do_proto:
 				m = re.match(r"^GLAPI ", line)
@@ -35,7 +42,7 @@ with open('glcorearb.h', 'r') as f:
 				pass
 			if do_extension:
 			#	m = re.match(r".* PFNGL([^)]+)PROC\)", line)
-				m = re.match(r"GLAPI .* APIENTRY gl([^ ]+) \(", line)
+				m = re.match(r"GLAPI .*\bAPIENTRY gl([^ ]+) \(", line)
 				if m != None:
 					lc = m.group(1)
 					uc = lc.upper()
@@ -45,6 +52,102 @@ with open('glcorearb.h', 'r') as f:
 			if m != None:
 				in_version = None
 
+#bucket a function (by name, without the 'gl' prefix) for per-frame totals:
+def category(name):
+	if re.match(r"^(Draw|MultiDraw|Clear$)", name):
+		return "Draw"
+	if re.match(r"^(Bind|UseProgram$|ActiveTexture$)", name):
+		return "Bind"
+	if re.match(r"^(BufferData|BufferSubData|MapBuffer|UnmapBuffer|FlushMappedBufferRange|TexImage|TexSubImage|CompressedTex|CopyBufferSubData|GenerateMipmap)", name):
+		return "Upload"
+	if re.match(r"^(Enable|Disable|Blend|Depth|Stencil|ColorMask|CullFace|FrontFace|PolygonMode|PolygonOffset|Viewport|Scissor|ClearColor|ClearDepth|ClearStencil|LineWidth|PointSize|Hint|PixelStore|TexParameter|SamplerParameter|Uniform|VertexAttribPointer|VertexAttribIPointer|VertexAttribDivisor|ProvokingVertex|PrimitiveRestartIndex|SampleCoverage|SampleMask|LogicOp)", name):
+		return "State"
+	return "Other"
+
+#names of a parameter list's parameters (the last identifier of each):
+def arguments(params):
+	if params.strip() == "void":
+		return []
+	return [ re.search(r"(\w+)\s*$", p).group(1) for p in params.split(",") ]
+
+if sys.argv[1:] == ["--trace"]:
+	print("""#ifndef GL_TRACE_HPP
+#define GL_TRACE_HPP 1
+
+//generated by 'make-gl-shims.py --trace' -- do not edit.
+//Included by GL.hpp when built with GL_TRACE defined: every GL call then goes through a wrapper that
+// counts and times it. Without GL_TRACE, this header isn't included at all.
+//NOTE: counters aren't synchronized; make GL calls from one thread (as GL requires anyway).
+
+#include <chrono>
+#include <iosfwd>
+#include <stdint.h>
+
+namespace gl_trace {
+
+enum Category {
+	Bind, //binding objects (and ActiveTexture, UseProgram)
+	Upload, //buffer and texture data
+	Draw, //draws and clears
+	State, //fixed-function state, texture/sampler parameters, uniforms, attribute layout
+	Other,
+	Categories //(count)
+};
+char const *category_name(Category category);
+
+enum Function {""")
+	for (ret, name, params) in traced:
+		print("\t" + name + ",")
+	print("""	Functions //(count)
+};
+char const *function_name(Function function);
+
+struct Counts {
+	uint64_t calls = 0;
+	uint64_t ns = 0; //time spent in calls
+};
+extern Counts functions[Functions]; //since startup
+extern Counts frame[Categories]; //since begin_frame()
+
+//forget calls made since the last frame (e.g., while idle or starting up):
+void begin_frame();
+//add this frame's per-category totals to the history:
+void end_frame();
+//write per-frame category totals and the most expensive functions:
+void report(std::ostream &to);
+
+struct Scope {
+	Scope(Function function_, Category category_) : function(function_), category(category_), start(std::chrono::high_resolution_clock::now()) { }
+	~Scope() {
+		uint64_t ns = uint64_t(std::chrono::duration_cast< std::chrono::nanoseconds >(std::chrono::high_resolution_clock::now() - start).count());
+		functions[function].calls += 1;
+		functions[function].ns += ns;
+		frame[category].calls += 1;
+		frame[category].ns += ns;
+	}
+	Function function;
+	Category category;
+	std::chrono::high_resolution_clock::time_point start;
+};
+
+} //namespace gl_trace
+""")
+	for (ret, name, params) in traced:
+		call = "gl" + name + "(" + ", ".join(arguments(params)) + ")"
+		print("inline " + ret + " trace_gl" + name + "(" + params + ") { gl_trace::Scope scope(gl_trace::" + name + ", gl_trace::" + category(name) + "); " + ("" if ret == "void" else "return ") + call + "; }")
+		print("#define gl" + name + " trace_gl" + name)
+	print("""
+#ifdef GL_TRACE_NAMES
+//(for gl_trace.cpp)
+static char const *const gl_trace_function_names[] = {""")
+	for (ret, name, params) in traced:
+		print("\t\"gl" + name + "\",")
+	print("""};
+#endif //GL_TRACE_NAMES
+
+#endif //GL_TRACE_HPP""")
+	sys.exit(0)
+
 print("""#ifndef GL_SHIMS_HPP
 #define GL_SHIMS_HPP 1
 
@@ -0,0 +1,92 @@
+#include "mapped_file.hpp"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+bool MappedFile::open(std::string const &filename) {
+	close();
+	HANDLE f = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (f == INVALID_HANDLE_VALUE) return false;
+	LARGE_INTEGER length;
+	if (!GetFileSizeEx(f, &length)) {
+		CloseHandle(f);
+		return false;
+	}
+	if (length.QuadPart == 0) {
+		CloseHandle(f);
+		is_empty_file = true;
+		return true;
+	}
+	HANDLE m = CreateFileMappingA(f, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (m == NULL) {
+		CloseHandle(f);
+		return false;
+	}
+	void *view = MapViewOfFile(m, FILE_MAP_READ, 0, 0, 0);
+	if (view == NULL) {
+		CloseHandle(m);
+		CloseHandle(f);
+		return false;
+	}
+	file = f;
+	mapping = m;
+	data = reinterpret_cast< uint8_t const * >(view);
+	size = size_t(length.QuadPart);
+	return true;
+}
+
+void MappedFile::close() {
+	if (data) UnmapViewOfFile(data);
+	if (mapping) CloseHandle(mapping);
+	if (file) CloseHandle(file);
+	data = nullptr;
+	size = 0;
+	mapping = nullptr;
+	file = nullptr;
+	is_empty_file = false;
+}
+
+#else
+
+bool MappedFile::open(std::string const &filename) {
+	close();
+	int fd = ::open(filename.c_str(), O_RDONLY);
+	if (fd < 0) return false;
+	struct stat info;
+	if (fstat(fd, &info) != 0) {
+		::close(fd);
+		return false;
+	}
+	if (info.st_size == 0) {
+		::close(fd);
+		is_empty_file = true;
+		return true;
+	}
+	void *view = mmap(NULL, size_t(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+	//(the mapping stays valid after the descriptor is closed)
+	::close(fd);
+	if (view == MAP_FAILED) return false;
+	//whole-file sequential reads are the common case:
+	madvise(view, size_t(info.st_size), MADV_SEQUENTIAL);
+	data = reinterpret_cast< uint8_t const * >(view);
+	size = size_t(info.st_size);
+	return true;
+}
+
+void MappedFile::close() {
+	if (data) munmap(const_cast< uint8_t * >(data), size);
+	data = nullptr;
+	size = 0;
+	is_empty_file = false;
+}
+
+#endif
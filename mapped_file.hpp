@@ -0,0 +1,33 @@
+#pragma once
+
+#include <string>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Read-only memory mapping of a whole file.
+ */
+
+struct MappedFile {
+	MappedFile() = default;
+	explicit MappedFile(std::string const &filename) { open(filename); }
+	~MappedFile() { close(); }
+	MappedFile(MappedFile const &) = delete;
+	MappedFile &operator=(MappedFile const &) = delete;
+
+	//map 'filename'; returns false (leaving the mapping empty) on failure:
+	bool open(std::string const &filename);
+	void close();
+
+	bool is_open() const { return data != nullptr || is_empty_file; }
+
+	uint8_t const *data = nullptr;
+	size_t size = 0;
+
+private:
+	bool is_empty_file = false; //zero-length files can't be mapped, but do open fine
+	#ifdef _WIN32
+	void *file = nullptr;
+	void *mapping = nullptr;
+	#endif
+};
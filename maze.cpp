@@ -0,0 +1,229 @@
+#include "maze.hpp"
+
+#include <cassert>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+static inline uint32_t popcount64(uint64_t x) { return uint32_t(__popcnt64(x)); }
+#else
+static inline uint32_t popcount64(uint64_t x) { return uint32_t(__builtin_popcountll(x)); }
+#endif
+
+//------------ Bitset ------------
+
+Bitset::Bitset(uint32_t size_) : size(size_), words(size_t((uint64_t(size_) + 63) / 64), 0) {
+}
+
+void Bitset::clear() {
+	for (auto &w : words) w = 0;
+}
+
+uint32_t Bitset::count() const {
+	uint32_t total = 0;
+	for (auto const &w : words) {
+		total += popcount64(w);
+	}
+	return total;
+}
+
+Bitset &Bitset::operator|=(Bitset const &other) {
+	assert(other.size == size);
+	for (uint32_t i = 0; i < words.size(); ++i) {
+		words[i] |= other.words[i];
+	}
+	return *this;
+}
+
+Bitset &Bitset::operator&=(Bitset const &other) {
+	assert(other.size == size);
+	for (uint32_t i = 0; i < words.size(); ++i) {
+		words[i] &= other.words[i];
+	}
+	return *this;
+}
+
+//out = in shifted toward higher tile indices by 'amount' bits (amount may be negative):
+static void shift_into(Bitset const &in, int64_t amount, Bitset *out) {
+	assert(out && out->size == in.size);
+	int64_t count = int64_t(in.words.size());
+	int64_t word_shift = (amount >= 0 ? amount : -amount) / 64;
+	uint32_t bit_shift = uint32_t((amount >= 0 ? amount : -amount) % 64);
+	for (int64_t i = 0; i < count; ++i) {
+		uint64_t w = 0;
+		if (amount >= 0) {
+			int64_t src = i - word_shift;
+			if (src >= 0) w = in.words[src] << bit_shift;
+			if (bit_shift && src - 1 >= 0) w |= in.words[src - 1] >> (64 - bit_shift);
+		} else {
+			int64_t src = i + word_shift;
+			if (src < count) w = in.words[src] >> bit_shift;
+			if (bit_shift && src + 1 < count) w |= in.words[src + 1] << (64 - bit_shift);
+		}
+		out->words[i] = w;
+	}
+	//keep bits past the end clear:
+	if (in.size % 64) out->words.back() &= (uint64_t(1) << (in.size % 64)) - 1;
+}
+
+//------------ Maze ------------
+
+//width * height, checked (in 64 bits) before anything is sized by it; every later width * height fits in a uint32_t:
+static uint32_t checked_tiles(uint32_t width, uint32_t height) {
+	if (width == 0 || height == 0 || uint64_t(width) * height > Maze::MaxTiles) {
+		throw std::length_error("maze of " + std::to_string(width) + "x" + std::to_string(height) + " tiles is empty or too large");
+	}
+	return width * height;
+}
+
+Maze::Maze(uint32_t width_, uint32_t height_) : width(width_), height(height_),
+	passage_words((checked_tiles(width_, height_) + 15) / 16, 0),
+	visited(width_ * height_), mines(width_ * height_), treasure(width_ * height_) {
+}
+
+uint32_t Maze::step(uint32_t tile, Direction dir) const {
+	assert(can_move(tile, dir));
+	if (dir == Up) return tile - width;
+	else if (dir == Left) return tile - 1;
+	else if (dir == Down) return tile + width;
+	else return tile + 1;
+}
+
+bool Maze::move(uint32_t *tile, Direction dir) {
+	assert(tile);
+	if (!can_move(*tile, dir)) return false;
+	*tile = step(*tile, dir);
+	visited.set(*tile);
+	return true;
+}
+
+void Maze::open(uint32_t tile, Direction dir) {
+	uint32_t r = row(tile);
+	uint32_t c = col(tile);
+	uint32_t other = tile;
+	Direction back = dir;
+	if (dir == Up) { assert(r > 0); other = tile - width; back = Down; }
+	else if (dir == Left) { assert(c > 0); other = tile - 1; back = Right; }
+	else if (dir == Down) { assert(r + 1 < height); other = tile + width; back = Up; }
+	else { assert(c + 1 < width); other = tile + 1; back = Left; }
+	passage_words[tile >> 4] |= uint64_t(1) << ((tile & 15) * 4 + dir);
+	passage_words[other >> 4] |= uint64_t(1) << ((other & 15) * 4 + back);
+}
+
+Bitset Maze::open_toward(Direction dir) const {
+	Bitset out(width * height);
+	//gather bit 'dir' of each nibble: four passage words (16 tiles each) make one bitset word:
+	for (uint32_t i = 0; i < passage_words.size(); ++i) {
+		uint64_t x = (passage_words[i] >> dir) & 0x1111111111111111ULL;
+		x = (x | (x >> 3)) & 0x0303030303030303ULL;
+		x = (x | (x >> 6)) & 0x000F000F000F000FULL;
+		x = (x | (x >> 12)) & 0x000000FF000000FFULL;
+		x = (x | (x >> 24)) & 0x000000000000FFFFULL;
+		out.words[i >> 2] |= x << ((i & 3) * 16);
+	}
+	return out;
+}
+
+Bitset Maze::expand(Bitset const &from) const {
+	assert(from.size == width * height);
+	Bitset out(from.size);
+	Bitset moving(from.size);
+	Bitset moved(from.size);
+	static const Direction dirs[4] = { Up, Left, Down, Right };
+	static const int64_t signs[4] = { -1, -1, 1, 1 };
+	for (uint32_t d = 0; d < 4; ++d) {
+		moving = open_toward(dirs[d]);
+		moving &= from;
+		//passages never lead off the edge, so a plain shift is enough:
+		int64_t amount = signs[d] * ((dirs[d] == Up || dirs[d] == Down) ? int64_t(width) : 1);
+		shift_into(moving, amount, &moved);
+		out |= moved;
+	}
+	return out;
+}
+
+Bitset Maze::reachable(uint32_t tile, uint32_t *to_treasure) const {
+	assert(tile < width * height);
+	Bitset reached(width * height);
+	//(a maze's frontier is only a few tiles wide, so a tile-at-a-time search beats shifting whole bitsets)
+	std::vector< uint32_t > queue; //every tile reached, in order of distance
+	reached.set(tile);
+	queue.emplace_back(tile);
+	if (to_treasure) *to_treasure = -1U;
+	//breadth-first, one move-distance per pass:
+	size_t head = 0;
+	for (uint32_t moves = 0; head < queue.size(); ++moves) {
+		for (size_t end = queue.size(); head < end; ++head) {
+			uint32_t at = queue[head];
+			if (to_treasure && *to_treasure == -1U && treasure.get(at)) *to_treasure = moves;
+			for (uint32_t d = 0; d < 4; ++d) {
+				if (!can_move(at, Direction(d))) continue;
+				uint32_t to = step(at, Direction(d));
+				if (reached.get(to)) continue;
+				reached.set(to);
+				queue.emplace_back(to);
+			}
+		}
+	}
+	return reached;
+}
+
+Maze Maze::cave() {
+	Maze maze(5, 6);
+	// list the possible moves for each tile (up, left, down, right)
+	static const int neighbors[30][4] = {{0,0,0,1}, {0,1,1,1}, {0,1,1,1}, {0,1,1,0}, {0,0,1,0},
+	                                     {0,0,1,0}, {1,0,0,0}, {1,0,1,1}, {1,1,1,0}, {1,0,1,0},
+	                                     {1,0,0,1}, {0,1,0,1}, {1,1,1,0}, {1,0,0,1}, {1,1,0,0},
+	                                     {0,0,1,0}, {0,0,1,1}, {1,1,0,1}, {0,1,1,1}, {0,1,1,0},
+	                                     {1,0,1,0}, {1,0,1,0}, {0,0,1,0}, {1,0,1,0}, {1,0,0,0},
+	                                     {1,0,0,1}, {1,1,0,1}, {1,1,0,1}, {1,1,0,1}, {0,1,0,0}};
+	for (uint32_t t = 0; t < 30; ++t) {
+		for (uint32_t d = 0; d < 4; ++d) {
+			if (neighbors[t][d]) {
+				maze.passage_words[t >> 4] |= uint64_t(1) << ((t & 15) * 4 + d);
+			}
+		}
+	}
+	maze.treasure.set(maze.tile(0, 4));
+	maze.mines.set(maze.tile(1, 0));
+	maze.mines.set(maze.tile(3, 0));
+	maze.mines.set(maze.tile(4, 2));
+	maze.mines.set(maze.tile(5, 4));
+	maze.start = maze.tile(3, 2);
+	maze.visited.set(maze.start);
+	return maze;
+}
+
+Maze Maze::generate(uint32_t width, uint32_t height, uint64_t seed, float mine_fraction) {
+	Maze maze(width, height);
+	std::mt19937_64 mt(seed);
+
+	//binary-tree maze: every tile opens a passage either up or left (when it can);
+	// linear time and memory, so it is fine for very large mazes:
+	for (uint32_t r = 0; r < height; ++r) {
+		for (uint32_t c = 0; c < width; ++c) {
+			uint32_t t = maze.tile(r, c);
+			if (r > 0 && c > 0) maze.open(t, (mt() & 1) ? Up : Left);
+			else if (r > 0) maze.open(t, Up);
+			else if (c > 0) maze.open(t, Left);
+		}
+	}
+
+	uint32_t count = width * height;
+	maze.start = uint32_t(mt() % count);
+	maze.visited.set(maze.start);
+	if (count > 1) {
+		uint32_t t;
+		do { t = uint32_t(mt() % count); } while (t == maze.start);
+		maze.treasure.set(t);
+	}
+	uint32_t mine_count = uint32_t(mine_fraction * count);
+	for (uint32_t m = 0; m < mine_count; ++m) {
+		uint32_t t = uint32_t(mt() % count);
+		if (t == maze.start || maze.treasure.get(t)) continue;
+		maze.mines.set(t);
+	}
+	return maze;
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <vector>
+#include <stdint.h>
+
+/*
+ * Maze stored as bitboards: a 4-bit passage mask per tile, packed sixteen
+ * tiles to a 64-bit word, plus one-bit-per-tile sets of visited, mine, and
+ * treasure tiles. Tiles are numbered row-major from the upper-left corner.
+ *
+ * Bulk queries (counting, one-step reachability) work a whole 64-bit word
+ * -- i.e., 64 or 16 tiles -- at a time.
+ */
+
+//passage directions, in the order used by the passage masks:
+enum Direction {
+	Up = 0,
+	Left = 1,
+	Down = 2,
+	Right = 3,
+};
+
+struct Bitset {
+	explicit Bitset(uint32_t size = 0);
+
+	bool get(uint32_t i) const { return (words[i >> 6] >> (i & 63)) & 1; }
+	void set(uint32_t i) { words[i >> 6] |= (uint64_t(1) << (i & 63)); }
+	void reset(uint32_t i) { words[i >> 6] &= ~(uint64_t(1) << (i & 63)); }
+
+	void clear(); //reset all bits
+	uint32_t count() const; //number of set bits
+
+	Bitset &operator|=(Bitset const &other);
+	Bitset &operator&=(Bitset const &other);
+
+	uint32_t size = 0;
+	std::vector< uint64_t > words; //bits past 'size' are always zero
+};
+
+struct Maze {
+	//throws std::length_error unless 0 < width * height <= MaxTiles:
+	Maze(uint32_t width, uint32_t height);
+
+	//tile indices are uint32_t; this leaves room to count one past the last tile (and its word):
+	static const uint32_t MaxTiles = 0x80000000u;
+
+	uint32_t tile(uint32_t row, uint32_t col) const { return row * width + col; }
+	uint32_t row(uint32_t tile) const { return tile / width; }
+	uint32_t col(uint32_t tile) const { return tile % width; }
+
+	//4-bit mask of open passages out of 'tile' (bit d set <=> can move in Direction d):
+	uint32_t passages(uint32_t tile) const { return (passage_words[tile >> 4] >> ((tile & 15) * 4)) & 0xf; }
+	bool can_move(uint32_t tile, Direction dir) const { return (passages(tile) >> dir) & 1; }
+	//tile reached by moving from 'tile' in 'dir' (assumes can_move(tile, dir)):
+	uint32_t step(uint32_t tile, Direction dir) const;
+
+	//move explorer standing on '*tile' in 'dir' and mark the new tile visited; returns false (and does nothing) if blocked:
+	bool move(uint32_t *tile, Direction dir);
+
+	//open a passage between 'tile' and its neighbor in 'dir' (in both directions):
+	void open(uint32_t tile, Direction dir);
+
+	//tiles with an open passage in 'dir', as a bitset:
+	Bitset open_toward(Direction dir) const;
+	//tiles reachable in exactly one move from any tile in 'from':
+	Bitset expand(Bitset const &from) const;
+	//tiles reachable (in any number of moves) from 'tile', by breadth-first search;
+	// also stores the fewest moves from 'tile' to a treasure in '*to_treasure' (-1U if there is no way) if given:
+	Bitset reachable(uint32_t tile, uint32_t *to_treasure = nullptr) const;
+
+	//the hand-built 5x6 cave from the original game:
+	static Maze cave();
+	//a random (perfect) maze, with one treasure and mines on roughly 'mine_fraction' of tiles:
+	static Maze generate(uint32_t width, uint32_t height, uint64_t seed, float mine_fraction = 0.125f);
+
+	uint32_t width = 0;
+	uint32_t height = 0;
+	uint32_t start = 0; //tile the explorer starts on
+	std::vector< uint64_t > passage_words;
+	Bitset visited;
+	Bitset mines;
+	Bitset treasure;
+};
@@ -0,0 +1,301 @@
+#include "pixel_ops.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define PIXEL_OPS_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+//gcc and clang only allow wider intrinsics inside functions compiled for them:
+#if defined(__GNUC__)
+#define TARGET_SSE2 __attribute__((target("sse2")))
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define TARGET_SSE2
+#define TARGET_AVX2
+#endif
+
+//------------ scalar ------------
+
+//x * y / 255, rounded (exact for 8-bit x, y):
+static inline uint32_t mul_div_255(uint32_t x, uint32_t y) {
+	uint32_t t = x * y + 128;
+	return (t + (t >> 8)) >> 8;
+}
+
+static void premultiply_alpha_scalar(uint32_t *pixels, size_t count) {
+	for (size_t i = 0; i < count; ++i) {
+		uint32_t p = pixels[i];
+		uint32_t a = p >> 24;
+		pixels[i] = (a << 24)
+			| (mul_div_255((p >> 16) & 0xff, a) << 16)
+			| (mul_div_255((p >> 8) & 0xff, a) << 8)
+			| mul_div_255(p & 0xff, a);
+	}
+}
+
+static void swap_red_blue_scalar(uint32_t *pixels, size_t count) {
+	for (size_t i = 0; i < count; ++i) {
+		uint32_t p = pixels[i];
+		pixels[i] = (p & 0xff00ff00) | ((p >> 16) & 0xff) | ((p & 0xff) << 16);
+	}
+}
+
+static void swap_rows_scalar(uint32_t *a, uint32_t *b, size_t count) {
+	for (size_t i = 0; i < count; ++i) {
+		std::swap(a[i], b[i]);
+	}
+}
+
+//------------ SSE2 ------------
+
+#ifdef PIXEL_OPS_X86
+
+//premultiply four pixels' worth of 16-bit channels (two pixels per register half):
+TARGET_SSE2 static inline __m128i premultiply_16_sse2(__m128i c, __m128i color_mask, __m128i alpha_one) {
+	//broadcast each pixel's alpha to its color channels, and use 255 for the alpha channel itself:
+	__m128i a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(c, _MM_SHUFFLE(3,3,3,3)), _MM_SHUFFLE(3,3,3,3));
+	a = _mm_or_si128(_mm_and_si128(a, color_mask), alpha_one);
+	__m128i t = _mm_add_epi16(_mm_mullo_epi16(c, a), _mm_set1_epi16(128));
+	return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+}
+
+TARGET_SSE2 static void premultiply_alpha_sse2(uint32_t *pixels, size_t count) {
+	__m128i const zero = _mm_setzero_si128();
+	__m128i const color_mask = _mm_set_epi16(0, -1, -1, -1, 0, -1, -1, -1);
+	__m128i const alpha_one = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		__m128i v = _mm_loadu_si128(reinterpret_cast< __m128i const * >(pixels + i));
+		__m128i lo = premultiply_16_sse2(_mm_unpacklo_epi8(v, zero), color_mask, alpha_one);
+		__m128i hi = premultiply_16_sse2(_mm_unpackhi_epi8(v, zero), color_mask, alpha_one);
+		_mm_storeu_si128(reinterpret_cast< __m128i * >(pixels + i), _mm_packus_epi16(lo, hi));
+	}
+	premultiply_alpha_scalar(pixels + i, count - i);
+}
+
+TARGET_SSE2 static void swap_red_blue_sse2(uint32_t *pixels, size_t count) {
+	__m128i const ga_mask = _mm_set1_epi32(0xff00ff00);
+	__m128i const rb_mask = _mm_set1_epi32(0x00ff00ff);
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		__m128i v = _mm_loadu_si128(reinterpret_cast< __m128i const * >(pixels + i));
+		__m128i rb = _mm_and_si128(v, rb_mask);
+		rb = _mm_or_si128(_mm_slli_epi32(rb, 16), _mm_srli_epi32(rb, 16));
+		_mm_storeu_si128(reinterpret_cast< __m128i * >(pixels + i), _mm_or_si128(_mm_and_si128(v, ga_mask), rb));
+	}
+	swap_red_blue_scalar(pixels + i, count - i);
+}
+
+TARGET_SSE2 static void swap_rows_sse2(uint32_t *a, uint32_t *b, size_t count) {
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		__m128i va = _mm_loadu_si128(reinterpret_cast< __m128i const * >(a + i));
+		__m128i vb = _mm_loadu_si128(reinterpret_cast< __m128i const * >(b + i));
+		_mm_storeu_si128(reinterpret_cast< __m128i * >(a + i), vb);
+		_mm_storeu_si128(reinterpret_cast< __m128i * >(b + i), va);
+	}
+	swap_rows_scalar(a + i, b + i, count - i);
+}
+
+//------------ AVX2 ------------
+//(same as SSE2, eight pixels at a time; unpack/shuffle/pack all work per 128-bit lane, so pixel order is kept)
+
+TARGET_AVX2 static inline __m256i premultiply_16_avx2(__m256i c, __m256i color_mask, __m256i alpha_one) {
+	__m256i a = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(c, _MM_SHUFFLE(3,3,3,3)), _MM_SHUFFLE(3,3,3,3));
+	a = _mm256_or_si256(_mm256_and_si256(a, color_mask), alpha_one);
+	__m256i t = _mm256_add_epi16(_mm256_mullo_epi16(c, a), _mm256_set1_epi16(128));
+	return _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+}
+
+TARGET_AVX2 static void premultiply_alpha_avx2(uint32_t *pixels, size_t count) {
+	__m256i const zero = _mm256_setzero_si256();
+	__m256i const color_mask = _mm256_set_epi16(0, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1, 0, -1, -1, -1);
+	__m256i const alpha_one = _mm256_set_epi16(255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0);
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		__m256i v = _mm256_loadu_si256(reinterpret_cast< __m256i const * >(pixels + i));
+		__m256i lo = premultiply_16_avx2(_mm256_unpacklo_epi8(v, zero), color_mask, alpha_one);
+		__m256i hi = premultiply_16_avx2(_mm256_unpackhi_epi8(v, zero), color_mask, alpha_one);
+		_mm256_storeu_si256(reinterpret_cast< __m256i * >(pixels + i), _mm256_packus_epi16(lo, hi));
+	}
+	premultiply_alpha_scalar(pixels + i, count - i);
+}
+
+TARGET_AVX2 static void swap_red_blue_avx2(uint32_t *pixels, size_t count) {
+	__m256i const shuffle = _mm256_setr_epi8(
+		2,1,0,3, 6,5,4,7, 10,9,8,11, 14,13,12,15,
+		2,1,0,3, 6,5,4,7, 10,9,8,11, 14,13,12,15
+	);
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		__m256i v = _mm256_loadu_si256(reinterpret_cast< __m256i const * >(pixels + i));
+		_mm256_storeu_si256(reinterpret_cast< __m256i * >(pixels + i), _mm256_shuffle_epi8(v, shuffle));
+	}
+	swap_red_blue_scalar(pixels + i, count - i);
+}
+
+TARGET_AVX2 static void swap_rows_avx2(uint32_t *a, uint32_t *b, size_t count) {
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		__m256i va = _mm256_loadu_si256(reinterpret_cast< __m256i const * >(a + i));
+		__m256i vb = _mm256_loadu_si256(reinterpret_cast< __m256i const * >(b + i));
+		_mm256_storeu_si256(reinterpret_cast< __m256i * >(a + i), vb);
+		_mm256_storeu_si256(reinterpret_cast< __m256i * >(b + i), va);
+	}
+	swap_rows_scalar(a + i, b + i, count - i);
+}
+
+static bool cpu_has_sse2() {
+	#if defined(__x86_64__) || defined(_M_X64)
+	return true; //part of the x86-64 baseline
+	#elif defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 1);
+	return (info[3] & (1 << 26)) != 0;
+	#else
+	return __builtin_cpu_supports("sse2");
+	#endif
+}
+
+static bool cpu_has_avx2() {
+	#if defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 0);
+	if (info[0] < 7) return false;
+	__cpuid(info, 1);
+	bool osxsave = (info[2] & (1 << 27)) != 0;
+	bool avx = (info[2] & (1 << 28)) != 0;
+	//the OS must also save the upper halves of the ymm registers:
+	if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6) return false;
+	__cpuid(info, 7);
+	return (info[1] & (1 << 5)) != 0;
+	#else
+	//(also checks that the OS has enabled AVX state)
+	return __builtin_cpu_supports("avx2");
+	#endif
+}
+
+#endif //PIXEL_OPS_X86
+
+//------------ dispatch ------------
+
+namespace {
+struct Kernels {
+	SimdLevel level = SimdScalar;
+	void (*premultiply_alpha)(uint32_t *, size_t) = premultiply_alpha_scalar;
+	void (*swap_red_blue)(uint32_t *, size_t) = swap_red_blue_scalar;
+	void (*swap_rows)(uint32_t *, uint32_t *, size_t) = swap_rows_scalar;
+};
+}
+
+static SimdLevel supported_level() {
+	#ifdef PIXEL_OPS_X86
+	static SimdLevel supported = (cpu_has_avx2() ? SimdAVX2 : (cpu_has_sse2() ? SimdSSE2 : SimdScalar));
+	return supported;
+	#else
+	return SimdScalar;
+	#endif
+}
+
+static Kernels make_kernels(SimdLevel level) {
+	Kernels k;
+	level = std::min(level, supported_level());
+	k.level = level;
+	#ifdef PIXEL_OPS_X86
+	if (level == SimdSSE2) {
+		k.premultiply_alpha = premultiply_alpha_sse2;
+		k.swap_red_blue = swap_red_blue_sse2;
+		k.swap_rows = swap_rows_sse2;
+	} else if (level == SimdAVX2) {
+		k.premultiply_alpha = premultiply_alpha_avx2;
+		k.swap_red_blue = swap_red_blue_avx2;
+		k.swap_rows = swap_rows_avx2;
+	}
+	#endif
+	return k;
+}
+
+static Kernels &kernels() {
+	static Kernels k = make_kernels(SimdAVX2);
+	return k;
+}
+
+SimdLevel simd_level() {
+	return kernels().level;
+}
+
+SimdLevel set_simd_level(SimdLevel level) {
+	kernels() = make_kernels(level);
+	return kernels().level;
+}
+
+char const *simd_level_name(SimdLevel level) {
+	if (level == SimdAVX2) return "AVX2";
+	if (level == SimdSSE2) return "SSE2";
+	return "scalar";
+}
+
+//------------ kernels ------------
+
+void srgb_to_linear(uint32_t *pixels, size_t count) {
+	//a table lookup per channel beats any arithmetic version (there's no 8-bit gather to vectorize it with):
+	struct Table {
+		Table() {
+			for (uint32_t i = 0; i < 256; ++i) {
+				float c = i / 255.0f;
+				float l = (c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f));
+				to_linear[i] = uint8_t(std::min(255.0f, std::round(l * 255.0f)));
+			}
+		}
+		uint8_t to_linear[256];
+	};
+	static Table const table;
+	for (size_t i = 0; i < count; ++i) {
+		uint32_t p = pixels[i];
+		pixels[i] = (p & 0xff000000)
+			| (uint32_t(table.to_linear[(p >> 16) & 0xff]) << 16)
+			| (uint32_t(table.to_linear[(p >> 8) & 0xff]) << 8)
+			| uint32_t(table.to_linear[p & 0xff]);
+	}
+}
+
+void premultiply_alpha(uint32_t *pixels, size_t count) {
+	kernels().premultiply_alpha(pixels, count);
+}
+
+void swap_red_blue(uint32_t *pixels, size_t count) {
+	kernels().swap_red_blue(pixels, count);
+}
+
+void flip_rows(uint32_t *pixels, unsigned int width, unsigned int height, size_t stride) {
+	assert(stride >= width);
+	auto swap_rows = kernels().swap_rows;
+	for (unsigned int y = 0; y < height / 2; ++y) {
+		swap_rows(pixels + y * stride, pixels + (height - 1 - y) * stride, width);
+	}
+}
+
+void process_pixels(uint32_t *pixels, unsigned int width, unsigned int height, size_t stride, uint32_t ops) {
+	if (ops == PixelOpsNone) return;
+	//whole image in one go when rows are contiguous, otherwise a row at a time:
+	size_t count = width;
+	unsigned int rows = height;
+	if (stride == width) {
+		count = size_t(width) * height;
+		rows = 1;
+	}
+	for (unsigned int y = 0; y < rows; ++y) {
+		uint32_t *row = pixels + y * stride;
+		if (ops & SrgbToLinear) srgb_to_linear(row, count);
+		if (ops & PremultiplyAlpha) premultiply_alpha(row, count);
+		if (ops & SwapRedBlue) swap_red_blue(row, count);
+	}
+}
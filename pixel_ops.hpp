@@ -0,0 +1,44 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Post-decode processing of RGBA8 pixels (R in the lowest byte, as load_png
+ * produces them): flipping, alpha premultiplication, sRGB-to-linear and
+ * red/blue swizzling.
+ *
+ * premultiply_alpha, swap_red_blue and flip_rows have scalar, SSE2 and AVX2
+ * versions; the best one the CPU supports is picked the first time any
+ * kernel is used. srgb_to_linear is a table lookup, the same at every level.
+ */
+
+//Operations for process_pixels (applied in the order listed):
+enum PixelOps : uint32_t {
+	PixelOpsNone = 0,
+	SrgbToLinear = 1 << 0, //decode sRGB color channels to linear (8-bit, so dark values lose precision)
+	PremultiplyAlpha = 1 << 1, //scale color by alpha, for glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA)
+	SwapRedBlue = 1 << 2, //RGBA <-> BGRA
+};
+
+//Apply 'ops' to a width x height image whose rows are 'stride' pixels apart:
+void process_pixels(uint32_t *pixels, unsigned int width, unsigned int height, size_t stride, uint32_t ops);
+
+//Individual kernels, on 'count' consecutive pixels:
+void srgb_to_linear(uint32_t *pixels, size_t count);
+void premultiply_alpha(uint32_t *pixels, size_t count);
+void swap_red_blue(uint32_t *pixels, size_t count);
+
+//Swap rows top-to-bottom in place (converts between UpperLeftOrigin and LowerLeftOrigin):
+void flip_rows(uint32_t *pixels, unsigned int width, unsigned int height, size_t stride);
+
+//Which kernels are in use; set_simd_level clamps to what the CPU supports (useful for benchmarking;
+// don't call it while other threads are processing pixels):
+enum SimdLevel {
+	SimdScalar,
+	SimdSSE2,
+	SimdAVX2,
+};
+SimdLevel simd_level();
+SimdLevel set_simd_level(SimdLevel level);
+char const *simd_level_name(SimdLevel level);
@@ -0,0 +1,48 @@
+#include "pixel_upload.hpp"
+
+#include <cassert>
+#include <stdexcept>
+
+PixelUpload::PixelUpload(GLsizei width_, GLsizei height_) : width(width_), height(height_) {
+	GLsizeiptr size = GLsizeiptr(width) * height * sizeof(uint32_t);
+
+	glGenBuffers(1, &buffer);
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer);
+	glBufferData(GL_PIXEL_UNPACK_BUFFER, size, NULL, GL_STREAM_DRAW);
+	//(readable as well, since filling an atlas reads back image edges to extrude them into padding)
+	pixels = reinterpret_cast< uint32_t * >(glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size,
+		GL_MAP_READ_BIT | GL_MAP_WRITE_BIT));
+	//unbind right away, so other texture uploads keep reading from client memory:
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	if (!pixels) {
+		glDeleteBuffers(1, &buffer);
+		throw std::runtime_error("failed to map pixel upload buffer");
+	}
+}
+
+PixelUpload::~PixelUpload() {
+	if (pixels) {
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer);
+		glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	}
+	glDeleteBuffers(1, &buffer);
+}
+
+bool PixelUpload::finish(GLuint texture) {
+	assert(pixels);
+	//(bound first, so a caller recovering from a lost mapping can upload to it directly)
+	glBindTexture(GL_TEXTURE_2D, texture);
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer);
+	pixels = nullptr;
+	if (glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER) != GL_TRUE) {
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+		return false;
+	}
+	//rows are tightly packed, and uint32_t-aligned:
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	//(with an unpack buffer bound, the 'data' argument is an offset into it)
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, (GLbyte *)0);
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	return true;
+}
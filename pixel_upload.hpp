@@ -0,0 +1,30 @@
+#pragma once
+
+#include "GL.hpp"
+
+/*
+ * Texture upload through a pixel-unpack buffer, so image data can be decoded
+ * straight into driver memory instead of into a temporary copy.
+ *
+ * Usage:
+ *   PixelUpload upload(width, height);
+ *   ... write width * height RGBA pixels to upload.pixels (from any thread) ...
+ *   upload.finish(tex); //(on the GL thread)
+ */
+
+struct PixelUpload {
+	//create and map a buffer big enough for a width x height RGBA8 image:
+	PixelUpload(GLsizei width, GLsizei height);
+	~PixelUpload();
+	PixelUpload(PixelUpload const &) = delete;
+	PixelUpload &operator=(PixelUpload const &) = delete;
+
+	//unmap the buffer and upload its contents as level 0 of 'texture' (leaves 'texture' bound to GL_TEXTURE_2D either way);
+	// returns false if the mapped contents were lost (e.g., on a display mode change) and must be uploaded some other way:
+	bool finish(GLuint texture);
+
+	GLuint buffer = 0;
+	GLsizei width = 0;
+	GLsizei height = 0;
+	uint32_t *pixels = nullptr; //mapped storage, valid until finish()
+};
@@ -0,0 +1,136 @@
+#include "png_cache.hpp"
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <thread>
+
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#define LOG_ERROR( X ) std::cerr << X << std::endl
+
+//Each entry is a BlobHeader followed by width * height pixels:
+struct BlobHeader {
+	uint32_t magic = 0;
+	uint32_t width = 0;
+	uint32_t height = 0;
+	uint32_t reserved = 0;
+};
+static const uint32_t BlobMagic = 0x62786970; //'pixb' when read little-endian; bump to invalidate old entries
+
+PngCache::PngCache(std::string const &directory_) : directory(directory_) {
+	if (directory.empty()) return;
+	#ifdef _WIN32
+	_mkdir(directory.c_str());
+	#else
+	mkdir(directory.c_str(), 0755);
+	#endif
+}
+
+std::string PngCache::key(uint8_t const *bytes, size_t size, OriginLocation origin) const {
+	char name[32];
+	snprintf(name, sizeof(name), "%016llx-%s", (unsigned long long)hash_bytes(bytes, size), (origin == LowerLeftOrigin ? "ll" : "ul"));
+	return name;
+}
+
+uint32_t const *PngCache::find(std::string const &key, unsigned int width, unsigned int height, MappedFile *blob) const {
+	assert(blob);
+	if (!enabled()) return nullptr;
+	if (!blob->open(directory + "/" + key + ".rgba")) return nullptr;
+
+	BlobHeader header;
+	if (blob->size != sizeof(header) + size_t(width) * height * sizeof(uint32_t)) {
+		blob->close();
+		return nullptr;
+	}
+	std::memcpy(&header, blob->data, sizeof(header));
+	if (header.magic != BlobMagic || header.width != width || header.height != height) {
+		blob->close();
+		return nullptr;
+	}
+	return reinterpret_cast< uint32_t const * >(blob->data + sizeof(header));
+}
+
+bool PngCache::store(std::string const &key, unsigned int width, unsigned int height, uint32_t const *pixels, size_t stride) const {
+	if (!enabled()) return false;
+
+	BlobHeader header;
+	header.magic = BlobMagic;
+	header.width = width;
+	header.height = height;
+
+	//write under a temporary name and rename into place, so a reader never maps a partial entry:
+	std::string path = directory + "/" + key + ".rgba";
+	std::string temp = path + ".tmp" + std::to_string(std::hash< std::thread::id >()(std::this_thread::get_id()));
+	{
+		std::ofstream file(temp.c_str(), std::ios::binary);
+		file.write(reinterpret_cast< char const * >(&header), sizeof(header));
+		for (unsigned int y = 0; y < height; ++y) {
+			file.write(reinterpret_cast< char const * >(pixels + y * stride), width * sizeof(uint32_t));
+		}
+		if (!file) {
+			LOG_ERROR("  failed to write decode cache entry '" << temp << "'.");
+			file.close();
+			std::remove(temp.c_str());
+			return false;
+		}
+	}
+	if (std::rename(temp.c_str(), path.c_str()) != 0) {
+		//(on Windows, rename fails if another run already stored the same entry; that's fine)
+		std::remove(temp.c_str());
+		return false;
+	}
+	return true;
+}
+
+//xxHash64-style: four independent lanes so the multiplies overlap, then a final avalanche:
+uint64_t hash_bytes(uint8_t const *bytes, size_t size) {
+	static const uint64_t P1 = 0x9E3779B185EBCA87ULL;
+	static const uint64_t P2 = 0xC2B2AE3D27D4EB4FULL;
+	static const uint64_t P3 = 0x165667B19E3779F9ULL;
+	auto rotl = [](uint64_t x, int r) { return (x << r) | (x >> (64 - r)); };
+	auto round = [&rotl](uint64_t acc, uint64_t word) { return rotl(acc + word * P2, 31) * P1; };
+
+	uint64_t h;
+	size_t i = 0;
+	if (size >= 32) {
+		uint64_t lanes[4] = { P1 + P2, P2, 0, 0 - P1 };
+		for (; i + 32 <= size; i += 32) {
+			for (unsigned int l = 0; l < 4; ++l) {
+				uint64_t word;
+				std::memcpy(&word, bytes + i + 8 * l, 8);
+				lanes[l] = round(lanes[l], word);
+			}
+		}
+		h = rotl(lanes[0], 1) + rotl(lanes[1], 7) + rotl(lanes[2], 12) + rotl(lanes[3], 18);
+		for (unsigned int l = 0; l < 4; ++l) {
+			h = (h ^ round(0, lanes[l])) * P1 + P3;
+		}
+	} else {
+		h = P3;
+	}
+	h += size;
+	for (; i + 8 <= size; i += 8) {
+		uint64_t word;
+		std::memcpy(&word, bytes + i, 8);
+		h = rotl(h ^ round(0, word), 27) * P1 + P3;
+	}
+	for (; i < size; ++i) {
+		h = rotl(h ^ (bytes[i] * P3), 11) * P1;
+	}
+
+	h ^= h >> 33;
+	h *= P2;
+	h ^= h >> 29;
+	h *= P3;
+	h ^= h >> 32;
+	return h;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "load_save_png.hpp"
+#include "mapped_file.hpp"
+
+#include <string>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Disk cache of decoded PNGs, so repeat launches with unchanged assets can
+ * map raw pixels instead of running libpng.
+ *
+ * Entries are keyed on a hash of the PNG file's bytes (plus the requested
+ * origin), so an edited image simply misses; stale entries are never read,
+ * only left behind (delete the directory to reclaim the space).
+ */
+
+struct PngCache {
+	//cache entries live in 'directory' (created if needed); an empty directory disables the cache:
+	explicit PngCache(std::string const &directory = "");
+
+	//name of the cache entry for PNG data 'bytes' decoded with 'origin':
+	std::string key(uint8_t const *bytes, size_t size, OriginLocation origin) const;
+
+	//map the pixels stored under 'key' into 'blob'; returns nullptr on a miss (or if they aren't width x height):
+	uint32_t const *find(std::string const &key, unsigned int width, unsigned int height, MappedFile *blob) const;
+
+	//store width x height pixels, rows 'stride' pixels apart, under 'key'; returns false on failure:
+	bool store(std::string const &key, unsigned int width, unsigned int height, uint32_t const *pixels, size_t stride) const;
+
+	bool enabled() const { return !directory.empty(); }
+
+	std::string directory;
+};
+
+//Fast (non-cryptographic) 64-bit hash of 'size' bytes:
+uint64_t hash_bytes(uint8_t const *bytes, size_t size);
@@ -0,0 +1,245 @@
+#include "png_encode.hpp"
+#include "thread_pool.hpp"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#define LOG_ERROR( X ) std::cerr << X << std::endl
+
+//------------ filtering ------------
+
+static inline uint8_t paeth(uint8_t a, uint8_t b, uint8_t c) {
+	int p = int(a) + int(b) - int(c);
+	int pa = std::abs(p - int(a));
+	int pb = std::abs(p - int(b));
+	int pc = std::abs(p - int(c));
+	if (pa <= pb && pa <= pc) return a;
+	if (pb <= pc) return b;
+	return c;
+}
+
+//write 'row' (with 'prev' the row above, or nullptr for the first row) filtered with 'filter' to 'out':
+//(the first pixel has no left neighbor, and the first row nothing above; PNG treats both as zero)
+static void filter_row(int filter, uint8_t const *row, uint8_t const *prev, size_t bytes, uint8_t *out) {
+	static const size_t Bpp = 4; //bytes per pixel
+	if (filter == PngEncodeOptions::FilterNone || (!prev && filter == PngEncodeOptions::FilterUp)) {
+		std::memcpy(out, row, bytes);
+	} else if (filter == PngEncodeOptions::FilterSub || (!prev && filter == PngEncodeOptions::FilterPaeth)) {
+		//(with nothing above, Paeth always predicts the left neighbor)
+		std::memcpy(out, row, Bpp);
+		for (size_t i = Bpp; i < bytes; ++i) out[i] = uint8_t(row[i] - row[i - Bpp]);
+	} else if (filter == PngEncodeOptions::FilterUp) {
+		for (size_t i = 0; i < bytes; ++i) out[i] = uint8_t(row[i] - prev[i]);
+	} else if (filter == PngEncodeOptions::FilterAverage && !prev) {
+		std::memcpy(out, row, Bpp);
+		for (size_t i = Bpp; i < bytes; ++i) out[i] = uint8_t(row[i] - (row[i - Bpp] >> 1));
+	} else if (filter == PngEncodeOptions::FilterAverage) {
+		for (size_t i = 0; i < Bpp; ++i) out[i] = uint8_t(row[i] - (prev[i] >> 1));
+		for (size_t i = Bpp; i < bytes; ++i) out[i] = uint8_t(row[i] - ((int(row[i - Bpp]) + int(prev[i])) >> 1));
+	} else {
+		assert(filter == PngEncodeOptions::FilterPaeth);
+		//(with nothing to the left, Paeth always predicts the byte above)
+		for (size_t i = 0; i < Bpp; ++i) out[i] = uint8_t(row[i] - prev[i]);
+		for (size_t i = Bpp; i < bytes; ++i) out[i] = uint8_t(row[i] - paeth(row[i - Bpp], prev[i], prev[i - Bpp]));
+	}
+}
+
+//append filter type byte and filtered 'row' to 'out':
+static void emit_row(PngEncodeOptions::Filter filter, uint8_t const *row, uint8_t const *prev, size_t bytes, uint8_t *out, std::vector< uint8_t > *scratch) {
+	if (filter != PngEncodeOptions::FilterAdaptive) {
+		out[0] = uint8_t(filter);
+		filter_row(filter, row, prev, bytes, out + 1);
+		return;
+	}
+	//adaptive: pick the filter with the smallest sum of absolute (signed) residuals:
+	scratch->resize(bytes);
+	uint64_t best_cost = ~0ULL;
+	for (int f = PngEncodeOptions::FilterNone; f <= PngEncodeOptions::FilterPaeth; ++f) {
+		filter_row(f, row, prev, bytes, &(*scratch)[0]);
+		uint64_t cost = 0;
+		for (size_t i = 0; i < bytes; ++i) {
+			cost += uint64_t(std::abs(int(int8_t((*scratch)[i]))));
+		}
+		if (cost < best_cost) {
+			best_cost = cost;
+			out[0] = uint8_t(f);
+			std::memcpy(out + 1, &(*scratch)[0], bytes);
+		}
+	}
+}
+
+//------------ encoding ------------
+
+static void put_u32(uint8_t *at, uint32_t value) {
+	at[0] = uint8_t(value >> 24);
+	at[1] = uint8_t(value >> 16);
+	at[2] = uint8_t(value >> 8);
+	at[3] = uint8_t(value);
+}
+
+//one stripe of rows, compressed to a complete IDAT chunk:
+struct Stripe {
+	unsigned int first_row = 0;
+	unsigned int rows = 0;
+	std::vector< uint8_t > chunk; //length, "IDAT", data, crc
+	uLong adler = 0; //adler32 of the (filtered) uncompressed data
+	uLong length = 0; //of the uncompressed data
+	bool ok = false;
+};
+
+bool save_png(std::ostream &to, unsigned int width, unsigned int height, uint32_t const *data, OriginLocation origin, PngEncodeOptions const &options, ThreadPool *pool) {
+	assert(data || width == 0 || height == 0);
+	if (width == 0 || height == 0) {
+		LOG_ERROR("  can't save an empty png.");
+		return false;
+	}
+	size_t row_bytes = size_t(width) * 4;
+
+	//split into stripes; tiny stripes waste compression, so keep each at least ~128k of input:
+	unsigned int stripe_rows = options.stripe_rows;
+	if (stripe_rows == 0) {
+		unsigned int stripes = (pool ? pool->size() * 4 : 1);
+		stripe_rows = (height + stripes - 1) / stripes;
+		stripe_rows = std::max(stripe_rows, (unsigned int)((128 * 1024 + row_bytes - 1) / row_bytes));
+	}
+	std::vector< Stripe > stripes((height + stripe_rows - 1) / stripe_rows);
+	for (size_t s = 0; s < stripes.size(); ++s) {
+		stripes[s].first_row = (unsigned int)s * stripe_rows;
+		stripes[s].rows = std::min(stripe_rows, height - stripes[s].first_row);
+	}
+
+	int level = std::max(0, std::min(9, options.level));
+	int strategy = Z_DEFAULT_STRATEGY;
+	if (options.strategy == PngEncodeOptions::StrategyFiltered) strategy = Z_FILTERED;
+	else if (options.strategy == PngEncodeOptions::StrategyRLE) strategy = Z_RLE;
+	else if (options.strategy == PngEncodeOptions::StrategyHuffmanOnly) strategy = Z_HUFFMAN_ONLY;
+
+	//PNG row 'r' (top to bottom):
+	auto png_row = [&](unsigned int r) -> uint8_t const * {
+		unsigned int y = (origin == LowerLeftOrigin ? height - 1 - r : r);
+		return reinterpret_cast< uint8_t const * >(data + size_t(y) * width);
+	};
+
+	//filter and compress one stripe as raw deflate data, ending on a byte boundary (Z_SYNC_FLUSH)
+	// so that stripes can simply be concatenated; only the last stripe finishes the stream.
+	//The first stripe leaves room for the zlib header and the last for the zlib trailer (adler32):
+	auto encode = [&](Stripe &stripe, bool first, bool last) {
+		std::vector< uint8_t > filtered((row_bytes + 1) * stripe.rows);
+		std::vector< uint8_t > scratch;
+		for (unsigned int i = 0; i < stripe.rows; ++i) {
+			unsigned int r = stripe.first_row + i;
+			emit_row(options.filter, png_row(r), (r > 0 ? png_row(r - 1) : nullptr), row_bytes, &filtered[i * (row_bytes + 1)], &scratch);
+		}
+		stripe.length = uLong(filtered.size());
+		stripe.adler = adler32(adler32(0L, Z_NULL, 0), &filtered[0], uInt(filtered.size()));
+
+		z_stream z;
+		std::memset(&z, 0, sizeof(z));
+		if (deflateInit2(&z, level, Z_DEFLATED, -15 /* raw deflate */, 8, strategy) != Z_OK) return;
+		size_t header = 8 + (first ? 2 : 0); //chunk length, type (and zlib header)
+		size_t footer = (last ? 4 : 0) + 4; //(zlib trailer and) chunk crc
+		//(a sync flush adds a few bytes past deflateBound)
+		stripe.chunk.resize(header + deflateBound(&z, uLong(filtered.size())) + 16 + footer);
+		z.next_in = &filtered[0];
+		z.avail_in = uInt(filtered.size());
+		z.next_out = &stripe.chunk[header];
+		z.avail_out = uInt(stripe.chunk.size() - header - footer);
+		int result = deflate(&z, last ? Z_FINISH : Z_SYNC_FLUSH);
+		size_t compressed = stripe.chunk.size() - header - footer - z.avail_out;
+		deflateEnd(&z);
+		if (result != (last ? Z_STREAM_END : Z_OK) || z.avail_in != 0) return;
+
+		stripe.chunk.resize(header + compressed + footer);
+		put_u32(&stripe.chunk[0], uint32_t(stripe.chunk.size() - 12));
+		std::memcpy(&stripe.chunk[4], "IDAT", 4);
+		stripe.ok = true;
+	};
+
+	for (size_t s = 0; s < stripes.size(); ++s) {
+		bool first = (s == 0);
+		bool last = (s + 1 == stripes.size());
+		if (pool) {
+			pool->run([&encode, &stripes, s, first, last](){ encode(stripes[s], first, last); });
+		} else {
+			encode(stripes[s], first, last);
+		}
+	}
+	if (pool) pool->wait();
+
+	for (auto const &stripe : stripes) {
+		if (!stripe.ok) {
+			LOG_ERROR("  failed to compress png stripe.");
+			return false;
+		}
+	}
+
+	//the zlib stream wrapper: a two-byte header in front of the first stripe and, after the last,
+	// the adler32 of all the uncompressed data (combined from the per-stripe checksums):
+	uLong adler = stripes[0].adler;
+	for (size_t s = 1; s < stripes.size(); ++s) {
+		adler = adler32_combine(adler, stripes[s].adler, stripes[s].length);
+	}
+	//(32k window, deflate; the level hint is informative, and each value keeps (cmf << 8 | flg) a multiple of 31)
+	std::vector< uint8_t > &head = stripes[0].chunk;
+	head[8] = 0x78;
+	head[9] = uint8_t(level >= 7 ? 0xda : (level >= 6 ? 0x9c : (level >= 2 ? 0x5e : 0x01)));
+	std::vector< uint8_t > &tail = stripes.back().chunk;
+	put_u32(&tail[tail.size() - 8], uint32_t(adler));
+
+	//chunk crcs cover type and data (so have to wait for the zlib wrapper); cheap next to compression:
+	for (auto &stripe : stripes) {
+		std::vector< uint8_t > &chunk = stripe.chunk;
+		put_u32(&chunk[chunk.size() - 4], uint32_t(crc32(crc32(0L, Z_NULL, 0), &chunk[4], uInt(chunk.size() - 8))));
+	}
+
+	//write signature, header, data, end:
+	auto write_chunk = [&to](char const *type, uint8_t const *payload, uint32_t length) {
+		uint8_t header[8];
+		put_u32(header, length);
+		std::memcpy(header + 4, type, 4);
+		uLong crc = crc32(crc32(0L, Z_NULL, 0), header + 4, 4);
+		if (length) crc = crc32(crc, payload, length);
+		uint8_t footer[4];
+		put_u32(footer, uint32_t(crc));
+		to.write(reinterpret_cast< char const * >(header), 8);
+		if (length) to.write(reinterpret_cast< char const * >(payload), length);
+		to.write(reinterpret_cast< char const * >(footer), 4);
+	};
+
+	static const uint8_t Signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+	to.write(reinterpret_cast< char const * >(Signature), 8);
+
+	uint8_t ihdr[13];
+	put_u32(ihdr + 0, width);
+	put_u32(ihdr + 4, height);
+	ihdr[8] = 8; //bit depth
+	ihdr[9] = 6; //color type: RGBA
+	ihdr[10] = 0; //compression: deflate
+	ihdr[11] = 0; //filter method: adaptive (per-row filter types)
+	ihdr[12] = 0; //no interlace
+	write_chunk("IHDR", ihdr, 13);
+
+	for (auto const &stripe : stripes) {
+		to.write(reinterpret_cast< char const * >(&stripe.chunk[0]), stripe.chunk.size());
+	}
+
+	write_chunk("IEND", nullptr, 0);
+
+	if (!to) {
+		LOG_ERROR("  failed to write png.");
+		return false;
+	}
+	return true;
+}
+
+bool save_png(std::string filename, unsigned int width, unsigned int height, uint32_t const *data, OriginLocation origin, PngEncodeOptions const &options, ThreadPool *pool) {
+	std::ofstream file(filename.c_str(), std::ios::binary);
+	return save_png(file, width, height, data, origin, options, pool);
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "load_save_png.hpp"
+
+#include <iosfwd>
+#include <string>
+#include <stdint.h>
+
+/*
+ * Parallel PNG encoder: the image is split into stripes of rows, each stripe
+ * is filtered and deflated independently (on a thread pool, if given), and
+ * the pieces are stitched into one ordinary PNG stream. This costs a little
+ * compression at each stripe boundary, but encoding scales with cores.
+ */
+
+struct ThreadPool;
+
+struct PngEncodeOptions {
+	//zlib compression level: 0 (store) to 9 (smallest, slowest):
+	int level = 6;
+
+	//PNG row filter: a fixed filter for every row, or (Adaptive) the one that
+	// looks most compressible for each row, which is libpng's default behavior:
+	enum Filter {
+		FilterNone,
+		FilterSub,
+		FilterUp,
+		FilterAverage,
+		FilterPaeth,
+		FilterAdaptive,
+	} filter = FilterAdaptive;
+
+	//zlib strategy; Filtered or RLE can be faster and nearly as small on filtered image data:
+	enum Strategy {
+		StrategyDefault,
+		StrategyFiltered,
+		StrategyRLE,
+		StrategyHuffmanOnly,
+	} strategy = StrategyDefault;
+
+	//rows per stripe; 0 picks a size giving each pool thread a few stripes:
+	unsigned int stripe_rows = 0;
+};
+
+//Encode width x height RGBA pixels; returns false on failure.
+//If 'pool' is given, stripes are encoded in parallel on it (so do not call from one of its jobs):
+bool save_png(std::ostream &to, unsigned int width, unsigned int height, uint32_t const *data, OriginLocation origin, PngEncodeOptions const &options, ThreadPool *pool = nullptr);
+bool save_png(std::string filename, unsigned int width, unsigned int height, uint32_t const *data, OriginLocation origin, PngEncodeOptions const &options, ThreadPool *pool = nullptr);
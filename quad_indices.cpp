@@ -0,0 +1,36 @@
+#include "quad_indices.hpp"
+
+#include <algorithm>
+#include <vector>
+
+QuadIndices::QuadIndices() {
+	std::vector< uint16_t > indices;
+	indices.reserve(MaxQuads * 6);
+	for (uint32_t q = 0; q < MaxQuads; ++q) {
+		uint16_t base = uint16_t(q * 4);
+		//same two triangles (and windings) the strip would produce:
+		indices.insert(indices.end(), { uint16_t(base + 0), uint16_t(base + 1), uint16_t(base + 2) });
+		indices.insert(indices.end(), { uint16_t(base + 2), uint16_t(base + 1), uint16_t(base + 3) });
+	}
+
+	glGenBuffers(1, &buffer);
+	//(uploaded through the copy-write target so no vao's element binding is disturbed)
+	glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+	glBufferData(GL_COPY_WRITE_BUFFER, indices.size() * sizeof(uint16_t), &indices[0], GL_STATIC_DRAW);
+	glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+}
+
+QuadIndices::~QuadIndices() {
+	glDeleteBuffers(1, &buffer);
+}
+
+void QuadIndices::attach() const {
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer);
+}
+
+void QuadIndices::draw(GLint first, uint32_t quads) const {
+	for (uint32_t done = 0; done < quads; done += MaxQuads) {
+		uint32_t count = std::min(MaxQuads, quads - done);
+		glDrawElementsBaseVertex(GL_TRIANGLES, GLsizei(count * 6), GL_UNSIGNED_SHORT, (GLbyte *)0, first + GLint(done * 4));
+	}
+}
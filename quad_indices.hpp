@@ -0,0 +1,38 @@
+#pragma once
+
+#include "GL.hpp"
+
+#include <stdint.h>
+
+/*
+ * Shared, static index buffer for drawing runs of quads as indexed
+ * triangles. Each quad is four vertices in strip order (lower-left,
+ * upper-left, lower-right, upper-right, as the sprite code emits them) and
+ * six indices, instead of six vertices with the degenerate joins a single
+ * triangle strip needs.
+ *
+ * Indices are 16-bit; longer runs are drawn in batches of MaxQuads, each
+ * with its own base vertex.
+ *
+ * Usage:
+ *   QuadIndices indices;
+ *   glBindVertexArray(vao); indices.attach(); //once per vao
+ *   ... write 4 * count vertices starting at vertex 'first' ...
+ *   indices.draw(first, count); //with vao bound
+ */
+
+struct QuadIndices {
+	QuadIndices();
+	~QuadIndices();
+	QuadIndices(QuadIndices const &) = delete;
+	QuadIndices &operator=(QuadIndices const &) = delete;
+
+	//attach the indices to the bound vao (GL_ELEMENT_ARRAY_BUFFER binding is vao state):
+	void attach() const;
+	//draw 'quads' quads whose vertices start at vertex 'first' of the bound vao:
+	void draw(GLint first, uint32_t quads) const;
+
+	static const uint32_t MaxQuads = 65536 / 4; //quads per draw call (all 16-bit indexable)
+
+	GLuint buffer = 0;
+};
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "GL.hpp"
+
+#include <string>
+
+/*
+ * Compile shaders and link them into programs; both throw on failure
+ * (after printing the info log).
+ */
+
+GLuint compile_shader(GLenum type, std::string const &source);
+GLuint link_program(GLuint fragment_shader, GLuint vertex_shader);
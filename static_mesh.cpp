@@ -0,0 +1,24 @@
+#include "static_mesh.hpp"
+
+StaticMesh::StaticMesh(void const *data, GLsizeiptr size, GLsizei count_, std::function< void() > const &set_attributes, GlState &state) : count(count_) {
+	glGenVertexArrays(1, &vao);
+	state.bind_vertex_array(vao);
+
+	glGenBuffers(1, &buffer);
+	glBindBuffer(GL_ARRAY_BUFFER, buffer);
+	glBufferData(GL_ARRAY_BUFFER, size, data, GL_STATIC_DRAW);
+
+	set_attributes();
+
+	state.bind_vertex_array(0);
+}
+
+StaticMesh::~StaticMesh() {
+	glDeleteVertexArrays(1, &vao);
+	glDeleteBuffers(1, &buffer);
+}
+
+void StaticMesh::draw(GLenum mode, GlState &state) const {
+	state.bind_vertex_array(vao);
+	glDrawArrays(mode, 0, count);
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "GL.hpp"
+#include "gl_state.hpp"
+
+#include <functional>
+
+/*
+ * Retained geometry: vertex data that never changes after startup gets its
+ * own buffer and vertex array object, uploaded exactly once.
+ */
+
+struct StaticMesh {
+	//upload 'count' vertices ('size' bytes at 'data') with GL_STATIC_DRAW;
+	// 'set_attributes' is called with the new vao and buffer bound, to describe the vertex layout
+	// (the vao is bound through 'state', and left unbound afterward):
+	StaticMesh(void const *data, GLsizeiptr size, GLsizei count, std::function< void() > const &set_attributes, GlState &state);
+	~StaticMesh();
+	StaticMesh(StaticMesh const &) = delete;
+	StaticMesh &operator=(StaticMesh const &) = delete;
+
+	//bind vao (through 'state') and draw all vertices:
+	void draw(GLenum mode, GlState &state) const;
+
+	GLuint buffer = 0;
+	GLuint vao = 0;
+	GLsizei count = 0;
+};
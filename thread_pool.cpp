@@ -0,0 +1,103 @@
+#include "thread_pool.hpp"
+
+#include <cassert>
+
+//index of the pool worker running on this thread (or -1U for non-worker threads):
+static thread_local ThreadPool const *current_pool = nullptr;
+static thread_local uint32_t current_index = -1U;
+
+ThreadPool::ThreadPool(uint32_t threads) : pending(0), next_queue(0) {
+	if (threads == 0) threads = std::thread::hardware_concurrency();
+	if (threads == 0) threads = 1;
+	for (uint32_t i = 0; i < threads; ++i) {
+		queues.emplace_back(new Queue);
+	}
+	for (uint32_t i = 0; i < threads; ++i) {
+		workers.emplace_back(&ThreadPool::worker, this, i);
+	}
+}
+
+ThreadPool::~ThreadPool() {
+	wait();
+	{
+		std::unique_lock< std::mutex > lock(mutex);
+		quit = true;
+	}
+	work_available.notify_all();
+	for (auto &w : workers) {
+		w.join();
+	}
+}
+
+void ThreadPool::run(std::function< void() > const &job) {
+	uint32_t index;
+	if (current_pool == this) {
+		index = current_index;
+	} else {
+		index = next_queue.fetch_add(1) % uint32_t(queues.size());
+	}
+	pending.fetch_add(1);
+	{
+		std::unique_lock< std::mutex > lock(queues[index]->mutex);
+		queues[index]->jobs.emplace_back(job);
+	}
+	{ //(lock so a worker can't miss the wakeup between checking for work and sleeping)
+		std::unique_lock< std::mutex > lock(mutex);
+	}
+	work_available.notify_one();
+}
+
+void ThreadPool::wait() {
+	std::unique_lock< std::mutex > lock(mutex);
+	all_done.wait(lock, [this](){ return pending.load() == 0; });
+}
+
+bool ThreadPool::pop(uint32_t index, std::function< void() > *job) {
+	Queue &queue = *queues[index];
+	std::unique_lock< std::mutex > lock(queue.mutex);
+	if (queue.jobs.empty()) return false;
+	*job = std::move(queue.jobs.back());
+	queue.jobs.pop_back();
+	return true;
+}
+
+bool ThreadPool::steal(uint32_t index, std::function< void() > *job) {
+	for (uint32_t offset = 1; offset < queues.size(); ++offset) {
+		Queue &queue = *queues[(index + offset) % queues.size()];
+		std::unique_lock< std::mutex > lock(queue.mutex);
+		if (queue.jobs.empty()) continue;
+		*job = std::move(queue.jobs.front());
+		queue.jobs.pop_front();
+		return true;
+	}
+	return false;
+}
+
+void ThreadPool::worker(uint32_t index) {
+	current_pool = this;
+	current_index = index;
+	std::function< void() > job;
+	while (true) {
+		if (pop(index, &job) || steal(index, &job)) {
+			job();
+			job = nullptr;
+			if (pending.fetch_sub(1) == 1) {
+				std::unique_lock< std::mutex > lock(mutex);
+				all_done.notify_all();
+			}
+			continue;
+		}
+		std::unique_lock< std::mutex > lock(mutex);
+		if (quit) break;
+		//sleep until a job is queued (re-checking the queues once the lock is held):
+		work_available.wait(lock, [&](){
+			if (quit) return true;
+			for (auto const &q : queues) {
+				std::unique_lock< std::mutex > queue_lock(q->mutex);
+				if (!q->jobs.empty()) return true;
+			}
+			return false;
+		});
+		if (quit) break;
+	}
+}
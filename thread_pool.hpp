@@ -0,0 +1,53 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <stdint.h>
+
+/*
+ * Work-stealing thread pool: each worker has its own job queue; it runs its
+ * own jobs newest-first and, when out of work, steals the oldest jobs from
+ * other workers. Jobs may enqueue more jobs.
+ */
+
+struct ThreadPool {
+	//'threads' == 0 means one worker per hardware thread:
+	explicit ThreadPool(uint32_t threads = 0);
+	~ThreadPool();
+	ThreadPool(ThreadPool const &) = delete;
+	ThreadPool &operator=(ThreadPool const &) = delete;
+
+	//queue a job (on the calling worker's queue if called from a job, otherwise round-robin):
+	void run(std::function< void() > const &job);
+
+	//block until every queued job (including jobs queued by jobs) has finished:
+	void wait();
+
+	uint32_t size() const { return uint32_t(workers.size()); }
+
+private:
+	struct Queue {
+		std::mutex mutex;
+		std::deque< std::function< void() > > jobs;
+	};
+
+	bool pop(uint32_t index, std::function< void() > *job); //own queue, newest first
+	bool steal(uint32_t index, std::function< void() > *job); //other queues, oldest first
+	void worker(uint32_t index);
+
+	std::vector< std::unique_ptr< Queue > > queues;
+	std::vector< std::thread > workers;
+
+	std::mutex mutex; //guards sleeping/waking and 'quit'
+	std::condition_variable work_available;
+	std::condition_variable all_done;
+	std::atomic< uint64_t > pending; //jobs queued or running
+	std::atomic< uint32_t > next_queue;
+	bool quit = false;
+};
@@ -0,0 +1,185 @@
+#include "tilemap.hpp"
+#include "shader.hpp"
+#include "camera_uniforms.hpp"
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+Tilemap::Tilemap(glm::uvec2 const &size_, glm::vec2 const &origin_, glm::vec2 const &tile_size_, Tileset const &tileset_, GlState &state)
+	: size(size_), origin(origin_), tile_size(tile_size_), tileset(tileset_) {
+	assert(size.x > 0 && size.y > 0);
+	assert(tileset.columns > 0);
+
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+	{ //tile index texture (all tile 0 to start):
+		std::vector< uint16_t > data(size.x * size.y, 0);
+		glGenTextures(1, &tiles_tex);
+		state.active_texture(1);
+		state.bind_texture(1, tiles_tex);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_R16UI, size.x, size.y, 0, GL_RED_INTEGER, GL_UNSIGNED_SHORT, &data[0]);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	}
+
+	{ //fog texture (everything unexplored to start):
+		fog.assign(size.x * size.y, 0xff);
+		glGenTextures(1, &fog_tex);
+		state.active_texture(2);
+		state.bind_texture(2, fog_tex);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, size.x, size.y, 0, GL_RED, GL_UNSIGNED_BYTE, &fog[0]);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	}
+
+	{ //compile shader program:
+		GLuint vertex_shader = compile_shader(GL_VERTEX_SHADER,
+			std::string("#version 330\n")
+			+ CameraUniforms::GLSL +
+			"uniform mat4 world_to_map;\n"
+			"in vec4 Position;\n" //full-screen quad, in clip space
+			"out vec2 mapCoord;\n"
+			"void main() {\n"
+			"	gl_Position = Position;\n"
+			"	mapCoord = (world_to_map * (clip_to_world * Position)).xy;\n"
+			"}\n"
+		);
+
+		GLuint fragment_shader = compile_shader(GL_FRAGMENT_SHADER,
+			"#version 330\n"
+			"uniform usampler2D tiles;\n"
+			"uniform sampler2D tileset;\n"
+			"uniform sampler2D fog;\n"
+			"uniform vec2 tileset_origin;\n"
+			"uniform vec2 tileset_cell;\n"
+			"uniform uint tileset_columns;\n"
+			"in vec2 mapCoord;\n"
+			"out vec4 fragColor;\n"
+			"void main() {\n"
+			"	ivec2 tile = ivec2(floor(mapCoord));\n"
+			"	if (any(lessThan(tile, ivec2(0))) || any(greaterThanEqual(tile, textureSize(tiles, 0)))) {\n"
+			"		discard;\n" //(off the map: leave whatever was drawn behind it)
+			"	}\n"
+			"	uint id = texelFetch(tiles, tile, 0).r;\n"
+			"	vec2 cell = vec2(float(id % tileset_columns), float(id / tileset_columns));\n"
+			"	vec2 uv = tileset_origin + (cell + fract(mapCoord)) * tileset_cell;\n"
+			"	fragColor = textureLod(tileset, uv, 0.0);\n"
+			"	fragColor.rgb *= 1.0 - texelFetch(fog, tile, 0).r;\n"
+			"}\n"
+		);
+
+		program = link_program(fragment_shader, vertex_shader);
+		CameraUniforms::bind_block(program);
+
+		//look up uniform locations:
+		program_world_to_map = glGetUniformLocation(program, "world_to_map");
+		if (program_world_to_map == -1U) throw std::runtime_error("no uniform named world_to_map");
+		program_tiles = glGetUniformLocation(program, "tiles");
+		if (program_tiles == -1U) throw std::runtime_error("no uniform named tiles");
+		program_tileset = glGetUniformLocation(program, "tileset");
+		if (program_tileset == -1U) throw std::runtime_error("no uniform named tileset");
+		program_fog = glGetUniformLocation(program, "fog");
+		if (program_fog == -1U) throw std::runtime_error("no uniform named fog");
+		program_tileset_origin = glGetUniformLocation(program, "tileset_origin");
+		if (program_tileset_origin == -1U) throw std::runtime_error("no uniform named tileset_origin");
+		program_tileset_cell = glGetUniformLocation(program, "tileset_cell");
+		if (program_tileset_cell == -1U) throw std::runtime_error("no uniform named tileset_cell");
+		program_tileset_columns = glGetUniformLocation(program, "tileset_columns");
+		if (program_tileset_columns == -1U) throw std::runtime_error("no uniform named tileset_columns");
+	}
+
+	{ //full-screen quad (clip space):
+		GLuint program_Position = glGetAttribLocation(program, "Position");
+		if (program_Position == -1U) throw std::runtime_error("no attribute named Position");
+		glm::vec2 const corners[4] = {
+			glm::vec2(-1.0f,-1.0f),
+			glm::vec2(-1.0f, 1.0f),
+			glm::vec2( 1.0f,-1.0f),
+			glm::vec2( 1.0f, 1.0f),
+		};
+		quad.reset(new StaticMesh(corners, sizeof(corners), 4, [&](){
+			glVertexAttribPointer(program_Position, 2, GL_FLOAT, GL_FALSE, sizeof(glm::vec2), (GLbyte *)0);
+			glEnableVertexAttribArray(program_Position);
+		}, state));
+	}
+}
+
+Tilemap::~Tilemap() {
+	quad.reset();
+	glDeleteProgram(program);
+	glDeleteTextures(1, &fog_tex);
+	glDeleteTextures(1, &tiles_tex);
+}
+
+void Tilemap::set_tiles(std::vector< uint16_t > const &ids, GlState &state) {
+	assert(ids.size() == size.x * size.y);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	state.active_texture(1);
+	state.bind_texture(1, tiles_tex);
+	glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, size.x, size.y, GL_RED_INTEGER, GL_UNSIGNED_SHORT, &ids[0]);
+}
+
+void Tilemap::reveal(glm::uvec2 const &tile) {
+	assert(tile.x < size.x && tile.y < size.y);
+	uint8_t &texel = fog[tile.y * size.x + tile.x];
+	if (texel == 0x00) return;
+	texel = 0x00;
+	if (!fog_dirty) {
+		fog_dirty = true;
+		fog_dirty_min = fog_dirty_max = tile;
+	} else {
+		fog_dirty_min.x = std::min(fog_dirty_min.x, tile.x);
+		fog_dirty_min.y = std::min(fog_dirty_min.y, tile.y);
+		fog_dirty_max.x = std::max(fog_dirty_max.x, tile.x);
+		fog_dirty_max.y = std::max(fog_dirty_max.y, tile.y);
+	}
+}
+
+glm::vec2 Tilemap::tile_center(glm::uvec2 const &tile) const {
+	return glm::vec2(
+		origin.x + (tile.x + 0.5f) * tile_size.x,
+		origin.y - (tile.y + 0.5f) * tile_size.y
+	);
+}
+
+void Tilemap::draw(GLuint tileset_tex, GlState &state) {
+	//world -> map: tiles from upper-left corner, y downward:
+	glm::mat4 world_to_map = glm::mat4(
+		glm::vec4(1.0f / tile_size.x, 0.0f, 0.0f, 0.0f),
+		glm::vec4(0.0f,-1.0f / tile_size.y, 0.0f, 0.0f),
+		glm::vec4(0.0f, 0.0f, 1.0f, 0.0f),
+		glm::vec4(-origin.x / tile_size.x, origin.y / tile_size.y, 0.0f, 1.0f)
+	);
+
+	state.use_program(program);
+	state.uniform_matrix4fv(program_world_to_map, glm::value_ptr(world_to_map));
+	state.uniform1i(program_tileset, 0);
+	state.uniform1i(program_tiles, 1);
+	state.uniform1i(program_fog, 2);
+	state.uniform2fv(program_tileset_origin, glm::value_ptr(tileset.origin_uv));
+	state.uniform2fv(program_tileset_cell, glm::value_ptr(tileset.cell_uv));
+	state.uniform1ui(program_tileset_columns, tileset.columns);
+
+	state.bind_texture(2, fog_tex);
+	if (fog_dirty) {
+		//(just the rectangle around tiles revealed since the last draw, read out of the full-width CPU copy)
+		glm::uvec2 extent = fog_dirty_max - fog_dirty_min + glm::uvec2(1);
+		state.active_texture(2);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, size.x);
+		glTexSubImage2D(GL_TEXTURE_2D, 0, fog_dirty_min.x, fog_dirty_min.y, extent.x, extent.y, GL_RED, GL_UNSIGNED_BYTE, &fog[fog_dirty_min.y * size.x + fog_dirty_min.x]);
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+		fog_dirty = false;
+	}
+	state.bind_texture(1, tiles_tex);
+	state.bind_texture(0, tileset_tex);
+
+	quad->draw(GL_TRIANGLE_STRIP, state);
+}
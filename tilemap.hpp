@@ -0,0 +1,74 @@
+#pragma once
+
+#include "GL.hpp"
+#include "gl_state.hpp"
+#include "static_mesh.hpp"
+
+#include <glm/glm.hpp>
+
+#include <memory>
+#include <vector>
+#include <stdint.h>
+
+/*
+ * Tilemap renderer: the map is stored as a texture of tile indices, which
+ * the fragment shader resolves against a tileset (a grid of equally-sized
+ * cells somewhere in a texture). The whole map is drawn as one full-screen
+ * quad, so drawing cost does not depend on the size of the map; fragments
+ * off the map are discarded, so whatever was drawn first shows around it.
+ *
+ * The tilemap also holds the fog-of-war mask (one texel per tile).
+ *
+ * Map coordinates count tiles from the upper-left corner: x to the right,
+ * y downward (i.e., x is the column and y is the row).
+ */
+
+struct Tilemap {
+	struct Tileset {
+		glm::vec2 origin_uv = glm::vec2(0.0f); //texture coordinate of the upper-left corner of tile 0
+		glm::vec2 cell_uv = glm::vec2(0.0f); //size of a tile in texture coordinates (y is negative for LowerLeftOrigin textures)
+		uint32_t columns = 1; //tiles per row in the tileset
+	};
+
+	//'origin' is the world position of the upper-left corner of the map; 'tile_size' is the world size of one tile:
+	//NOTE: like draw() and set_tiles(), binds through 'state' (leaving the map's textures bound to units 1 and 2).
+	Tilemap(glm::uvec2 const &size, glm::vec2 const &origin, glm::vec2 const &tile_size, Tileset const &tileset, GlState &state);
+	~Tilemap();
+	Tilemap(Tilemap const &) = delete;
+	Tilemap &operator=(Tilemap const &) = delete;
+
+	//set tile indices (size.x * size.y of them, row-major starting with the top row):
+	void set_tiles(std::vector< uint16_t > const &ids, GlState &state);
+
+	//every tile starts unexplored; reveal a single tile (the fog texture is updated at the next draw,
+	// uploading only the rectangle around tiles revealed since the last one -- usually a single texel):
+	void reveal(glm::uvec2 const &tile);
+
+	//world position of the center of a tile:
+	glm::vec2 tile_center(glm::uvec2 const &tile) const;
+
+	//draw the map as seen through the view in CameraUniforms, with tileset from texture 'tileset_tex':
+	//NOTE: uses texture units 0-2; all state changes go through 'state'.
+	void draw(GLuint tileset_tex, GlState &state);
+
+	glm::uvec2 size;
+	glm::vec2 origin;
+	glm::vec2 tile_size;
+	Tileset tileset;
+
+	GLuint tiles_tex = 0; //R16UI tile indices
+	GLuint fog_tex = 0; //R8, 1 = unexplored
+	std::vector< uint8_t > fog; //contents of fog_tex
+	bool fog_dirty = false; //fog has changed since it was last uploaded
+	glm::uvec2 fog_dirty_min = glm::uvec2(0); //changed texels lie in [fog_dirty_min, fog_dirty_max] (if fog_dirty)
+	glm::uvec2 fog_dirty_max = glm::uvec2(0);
+	GLuint program = 0;
+	GLuint program_world_to_map = 0;
+	GLuint program_tiles = 0;
+	GLuint program_tileset = 0;
+	GLuint program_fog = 0;
+	GLuint program_tileset_origin = 0;
+	GLuint program_tileset_cell = 0;
+	GLuint program_tileset_columns = 0;
+	std::unique_ptr< StaticMesh > quad;
+};
@@ -0,0 +1,82 @@
+#include "vertex_ring.hpp"
+
+#include <cassert>
+#include <stdexcept>
+
+VertexRing::VertexRing(GLsizeiptr segment_size_, GLsizeiptr stride_) : stride(stride_) {
+	assert(stride > 0);
+	for (unsigned int s = 0; s < Segments; ++s) {
+		fences[s] = 0;
+	}
+	//round segment size up to a whole number of vertices:
+	segment_size = ((segment_size_ + stride - 1) / stride) * stride;
+
+	glGenBuffers(1, &buffer);
+	glBindBuffer(GL_ARRAY_BUFFER, buffer);
+	glBufferData(GL_ARRAY_BUFFER, segment_size * Segments, NULL, GL_STREAM_DRAW);
+}
+
+VertexRing::~VertexRing() {
+	for (unsigned int s = 0; s < Segments; ++s) {
+		if (fences[s]) glDeleteSync(fences[s]);
+	}
+	glDeleteBuffers(1, &buffer);
+}
+
+void VertexRing::wait(unsigned int segment) {
+	GLsync &sync = fences[segment];
+	if (!sync) return;
+	//flush on the first wait so the fence is guaranteed to eventually signal:
+	GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+	while (true) {
+		GLenum result = glClientWaitSync(sync, flags, 1000000000ULL);
+		if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED) break;
+		if (result == GL_WAIT_FAILED) throw std::runtime_error("glClientWaitSync failed on vertex ring fence");
+		flags = 0;
+	}
+	glDeleteSync(sync);
+	sync = 0;
+}
+
+void *VertexRing::map(GLsizeiptr size) {
+	assert(!mapped);
+	glBindBuffer(GL_ARRAY_BUFFER, buffer);
+
+	if (size > segment_size) {
+		//grow: wait until no segment is in use, then re-specify storage (keeps the buffer name, so VAOs stay valid):
+		for (unsigned int s = 0; s < Segments; ++s) {
+			wait(s);
+		}
+		while (segment_size < size) segment_size *= 2;
+		glBufferData(GL_ARRAY_BUFFER, segment_size * Segments, NULL, GL_STREAM_DRAW);
+		current = 0;
+	}
+
+	wait(current);
+
+	void *ptr = glMapBufferRange(GL_ARRAY_BUFFER, current * segment_size, segment_size,
+		GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_FLUSH_EXPLICIT_BIT);
+	if (!ptr) throw std::runtime_error("failed to map vertex ring segment");
+	mapped = true;
+	return ptr;
+}
+
+GLintptr VertexRing::unmap(GLsizeiptr used) {
+	assert(mapped);
+	assert(used <= segment_size);
+	glBindBuffer(GL_ARRAY_BUFFER, buffer);
+	if (used > 0) {
+		glFlushMappedBufferRange(GL_ARRAY_BUFFER, 0, used);
+	}
+	//(GL_FALSE here means storage was lost, e.g. on a mode switch; only this frame's vertices are affected)
+	glUnmapBuffer(GL_ARRAY_BUFFER);
+	mapped = false;
+	return current * segment_size;
+}
+
+void VertexRing::fence() {
+	assert(!mapped);
+	assert(!fences[current]);
+	fences[current] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	current = (current + 1) % Segments;
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "GL.hpp"
+
+/*
+ * Triple-buffered ring of vertex storage for data streamed every frame.
+ *
+ * Each frame maps one segment of a single GL_ARRAY_BUFFER, unsynchronized,
+ * so vertices are written straight into driver memory; a fence placed after
+ * the draws that read a segment keeps it from being rewritten while the GPU
+ * may still be using it.
+ *
+ * Usage (once per frame):
+ *   T *out = reinterpret_cast< T * >(ring.map(max_count * sizeof(T)));
+ *   ... write up to max_count items to out ...
+ *   GLint first = ring.unmap(count * sizeof(T)) / sizeof(T);
+ *   ... draw using vertices [first, first + count) ...
+ *   ring.fence();
+ */
+
+struct VertexRing {
+	//'stride' is the vertex size; segment offsets are kept a multiple of it,
+	// so the returned offsets can be turned into a 'first' vertex index:
+	VertexRing(GLsizeiptr segment_size, GLsizeiptr stride);
+	~VertexRing();
+	VertexRing(VertexRing const &) = delete;
+	VertexRing &operator=(VertexRing const &) = delete;
+
+	//map (at least) 'size' bytes of the next segment for writing, growing the buffer if needed:
+	void *map(GLsizeiptr size);
+	//flush the first 'used' bytes of the mapped segment and unmap it; returns the byte offset of the segment in 'buffer':
+	GLintptr unmap(GLsizeiptr used);
+	//mark the current segment as in-use by the commands issued so far, and advance to the next segment:
+	void fence();
+
+	static const unsigned int Segments = 3;
+
+	GLuint buffer = 0;
+	GLsizeiptr segment_size = 0;
+	GLsizeiptr stride = 1;
+	unsigned int current = 0;
+	GLsync fences[Segments];
+	bool mapped = false;
+
+private:
+	void wait(unsigned int segment);
+};